@@ -1,13 +1,13 @@
-#include "Game.h"
-
-Game game;
-
-void setup()
-{
-	game.setup();
-}
-
-void loop()
-{
-	game.loop();
+#include "Game.h"
+
+Game game;
+
+void setup()
+{
+	game.setup();
+}
+
+void loop()
+{
+	game.loop();
 }
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+/// An angle measured in fractions of a full turn.
+/// A full turn is the range of Type, so wrapping around is free.
+template<typename Type>
+class BinaryAngle
+{
+public:
+	using ValueType = Type;
+
+	static constexpr uint8_t bitSize = (sizeof(ValueType) * 8);
+
+private:
+	ValueType value;
+
+public:
+	BinaryAngle() = default;
+
+	explicit constexpr BinaryAngle(ValueType value) :
+		value { value }
+	{
+	}
+
+	static constexpr BinaryAngle quarterTurn()
+	{
+		return BinaryAngle(static_cast<ValueType>(1u << (bitSize - 2)));
+	}
+
+	static constexpr BinaryAngle halfTurn()
+	{
+		return BinaryAngle(static_cast<ValueType>(1u << (bitSize - 1)));
+	}
+
+	constexpr ValueType getValue() const
+	{
+		return this->value;
+	}
+
+	/// Gets the most significant 8 bits, which are used to index the lookup tables.
+	constexpr uint8_t getIndex() const
+	{
+		return static_cast<uint8_t>(this->value >> (bitSize - 8));
+	}
+
+	BinaryAngle & operator +=(BinaryAngle other)
+	{
+		this->value = static_cast<ValueType>(this->value + other.value);
+		return *this;
+	}
+
+	BinaryAngle & operator -=(BinaryAngle other)
+	{
+		this->value = static_cast<ValueType>(this->value - other.value);
+		return *this;
+	}
+
+	friend constexpr bool operator ==(BinaryAngle left, BinaryAngle right)
+	{
+		return (left.value == right.value);
+	}
+
+	friend constexpr bool operator !=(BinaryAngle left, BinaryAngle right)
+	{
+		return (left.value != right.value);
+	}
+
+	friend constexpr BinaryAngle operator -(BinaryAngle angle)
+	{
+		return BinaryAngle(static_cast<ValueType>(-angle.value));
+	}
+
+	friend constexpr BinaryAngle operator +(BinaryAngle left, BinaryAngle right)
+	{
+		return BinaryAngle(static_cast<ValueType>(left.value + right.value));
+	}
+
+	friend constexpr BinaryAngle operator -(BinaryAngle left, BinaryAngle right)
+	{
+		return BinaryAngle(static_cast<ValueType>(left.value - right.value));
+	}
+};
+
+using BinaryAngleU8 = BinaryAngle<uint8_t>;
+using BinaryAngleU16 = BinaryAngle<uint16_t>;
\ No newline at end of file
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "Geometry.h"
+#include "FixedPoints.h"
+#include "CommonTypes.h"
+#include "LevelFormat.h"
+
+// Reads a level's BSP tree in the compiled level format (see LevelFormat.h).
+// The tree is built offline by the level compiler.
+
+/// A partition of the level into the space in front of a line and the space behind it.
+class BspNode
+{
+private:
+	const uint8_t * data;
+
+public:
+	BspNode(const uint8_t * data) :
+		data{data}
+	{
+	}
+
+	/// Checks which side of the partition a point is on.
+	bool isInFront(const Point2SQ15x16 & point) const
+	{
+		const Vector2SQ15x16 normal
+		{
+			levelformat::readSQ15x16(&this->data[levelformat::node::normalX]),
+			levelformat::readSQ15x16(&this->data[levelformat::node::normalY]),
+		};
+
+		const SQ15x16 distance = levelformat::readSQ15x16(&this->data[levelformat::node::distance]);
+
+		return (dotProduct(Vector2SQ15x16(point.x, point.y), normal) >= distance);
+	}
+
+	/// Gets the child on one side of the partition.
+	uint16_t getChild(bool front) const
+	{
+		return pgm_read_word(&this->data[front ? levelformat::node::front : levelformat::node::back]);
+	}
+
+	/// Gets the corners of the box around everything on one side of the partition.
+	void getBox(bool front, Point2SQ15x16 & minimum, Point2SQ15x16 & maximum) const
+	{
+		const uint8_t * box = &this->data[front ? levelformat::node::frontBox : levelformat::node::backBox];
+
+		minimum = { pgm_read_byte(&box[0]), pgm_read_byte(&box[1]) };
+		maximum = { pgm_read_byte(&box[2]), pgm_read_byte(&box[3]) };
+	}
+};
+
+/// A wall, or the part of one that lies within a leaf.
+class BspSegment
+{
+private:
+	const uint8_t * data;
+
+public:
+	BspSegment(const uint8_t * data) :
+		data{data}
+	{
+	}
+
+	Point2SQ15x16 getStart() const
+	{
+		return { levelformat::readSQ15x16(&this->data[levelformat::segment::startX]), levelformat::readSQ15x16(&this->data[levelformat::segment::startY]) };
+	}
+
+	Point2SQ15x16 getEnd() const
+	{
+		return { levelformat::readSQ15x16(&this->data[levelformat::segment::endX]), levelformat::readSQ15x16(&this->data[levelformat::segment::endY]) };
+	}
+
+	/// Gets the distance along the wall at the start, scaled for texturing.
+	SQ15x16 getStartU() const
+	{
+		return levelformat::readSQ15x16(&this->data[levelformat::segment::startU]);
+	}
+
+	/// Gets the distance along the wall at the end, scaled for texturing.
+	SQ15x16 getEndU() const
+	{
+		return levelformat::readSQ15x16(&this->data[levelformat::segment::endU]);
+	}
+
+	SectorId getSector() const
+	{
+		return pgm_read_byte(&this->data[levelformat::segment::sector]);
+	}
+
+	SectorId getNeighbour() const
+	{
+		return pgm_read_byte(&this->data[levelformat::segment::neighbour]);
+	}
+
+	uint8_t getFlags() const
+	{
+		return pgm_read_byte(&this->data[levelformat::segment::flags]);
+	}
+
+	/// Gets the index within its sector of the edge that the segment is part of.
+	uint8_t getEdge() const
+	{
+		return pgm_read_byte(&this->data[levelformat::segment::edge]);
+	}
+};
+
+class Bsp
+{
+private:
+	const uint8_t * data;
+	const uint8_t * nodes;
+	const uint8_t * leaves;
+	const uint8_t * segments;
+
+public:
+	/// A null pointer makes an empty tree.
+	Bsp(const uint8_t * data) :
+		data{data},
+		nodes{(data != nullptr) ? &data[levelformat::bsp::nodes] : nullptr},
+		leaves{(data != nullptr) ? &this->nodes[pgm_read_word(&data[levelformat::bsp::nodeCount]) * levelformat::node::size] : nullptr},
+		segments{(data != nullptr) ? &this->leaves[pgm_read_word(&data[levelformat::bsp::leafCount]) * levelformat::leaf::size] : nullptr}
+	{
+	}
+
+	bool isEmpty() const
+	{
+		return (this->data == nullptr);
+	}
+
+	/// Gets the node or leaf to start from.
+	uint16_t getRoot() const
+	{
+		return pgm_read_word(&this->data[levelformat::bsp::root]);
+	}
+
+	static bool isLeaf(uint16_t child)
+	{
+		return ((child & levelformat::bsp::leafFlag) != 0);
+	}
+
+	BspNode getNode(uint16_t index) const
+	{
+		return { &this->nodes[index * levelformat::node::size] };
+	}
+
+	/// Gets the range of segments in a leaf, given the leaf's child reference.
+	void getLeaf(uint16_t child, uint16_t & firstSegment, uint8_t & segmentCount) const
+	{
+		const uint8_t * leaf = &this->leaves[(child & ~levelformat::bsp::leafFlag) * levelformat::leaf::size];
+
+		firstSegment = pgm_read_word(&leaf[levelformat::leaf::firstSegment]);
+		segmentCount = pgm_read_byte(&leaf[levelformat::leaf::segmentCount]);
+	}
+
+	BspSegment getSegment(uint16_t index) const
+	{
+		return { &this->segments[index * levelformat::segment::size] };
+	}
+};
\ No newline at end of file
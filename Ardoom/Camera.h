@@ -1,10 +1,91 @@
-#pragma once
-
-#include "Geometry.h"
-
-class Camera
-{
-public:
-	float angle;
-	Point2F position;
+#pragma once
+
+#include "FixedPoints.h"
+#include "Geometry.h"
+#include "BinaryAngle.h"
+#include "Trigonometry.h"
+#include "CommonTypes.h"
+
+class Camera
+{
+public:
+	Point2SQ15x16 position;
+
+	// The sector containing the position
+	SectorId sector;
+
+	// The height of the eye, on the same scale as the sectors' floors and ceilings.
+	// Half a unit is halfway up a wall standing on a floor at 0.
+	SQ15x16 height = 0.5;
+
+private:
+	BinaryAngleU16 angle;
+
+	// Cached basis, only recalculated when the angle changes
+	Vector2SQ15x16 forward;
+	Vector2SQ15x16 right;
+
+public:
+	// Faces along the x axis from the origin, with the basis to match
+	Camera() :
+		Camera(BinaryAngleU16(0), { 0, 0 })
+	{
+	}
+
+	Camera(BinaryAngleU16 angle, Point2SQ15x16 position, SectorId sector = 0, SQ15x16 height = 0.5) :
+		position { position }, sector { sector }, height { height }, angle { angle }
+	{
+		this->updateBasis();
+	}
+
+	BinaryAngleU16 getAngle() const
+	{
+		return this->angle;
+	}
+
+	void setAngle(BinaryAngleU16 angle)
+	{
+		if(this->angle == angle)
+			return;
+
+		this->angle = angle;
+		this->updateBasis();
+	}
+
+	void rotate(BinaryAngleU16 amount)
+	{
+		this->setAngle(this->angle + amount);
+	}
+
+	/// Gets the unit vector the camera is facing along.
+	const Vector2SQ15x16 & getForward() const
+	{
+		return this->forward;
+	}
+
+	/// Gets the unit vector a quarter turn clockwise of the forward vector.
+	const Vector2SQ15x16 & getRight() const
+	{
+		return this->right;
+	}
+
+	/// Gets a point's distances along the forward and right vectors, measured from the origin rather than the camera.
+	/// Subtracting the camera's position in the same terms puts the point in camera space,
+	/// and until the camera turns, the result only has to be worked out once.
+	Point2SQ15x16 toBasis(const Point2SQ15x16 & point) const
+	{
+		const Vector2SQ15x16 offset { point.x, point.y };
+
+		return { dotProduct(offset, this->forward), dotProduct(offset, this->right) };
+	}
+
+private:
+	void updateBasis()
+	{
+		const SQ15x16 cosine = maths::cos(this->angle);
+		const SQ15x16 sine = maths::sin(this->angle);
+
+		this->forward = { cosine, sine };
+		this->right = { -sine, cosine };
+	}
 };
\ No newline at end of file
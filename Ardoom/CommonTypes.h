@@ -1,5 +1,14 @@
-#pragma once
-
-#include <stdint.h>
-
-using SectorId = uint8_t;
\ No newline at end of file
+#pragma once
+
+#include <stdint.h>
+
+using SectorId = uint8_t;
+
+// Marks the absence of a sector, such as on the far side of a solid wall
+constexpr SectorId noSector = 0xFF;
+
+// A point's index among all of a level's points, counting through the sectors in order
+using PointId = uint16_t;
+
+// Marks the absence of a point, such as for the ends of a BSP segment
+constexpr PointId noPoint = 0xFFFF;
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+/// Counts the walls that SectorRenderer considered in a frame,
+/// and why those it didn't project were rejected.
+/// A rejected wall is counted once, by the first test it fails.
+struct CullStatistics
+{
+	// Walls that reached the culling stage
+	uint16_t walls;
+
+	// Walls entirely nearer than the near plane, or behind the camera
+	uint16_t behindNearPlane;
+
+	// Walls entirely beyond the left or right edge of the view
+	uint16_t outsideView;
+
+	// Walls whose back faces the camera
+	uint16_t backFacing;
+
+	/// Gets the number of walls that passed every test and were projected.
+	constexpr uint16_t getProjected() const
+	{
+		return (this->walls - this->behindNearPlane - this->outsideView - this->backFacing);
+	}
+};
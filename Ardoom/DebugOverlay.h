@@ -0,0 +1,155 @@
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "FrameBuffer.h"
+
+// Numbers drawn over a finished frame to help debug a map, such as the coordinates of corners.
+// Annotations are collected while the scene is drawn and drawn together afterwards,
+// so the scene's drawing isn't interleaved with text.
+// Digits come from a 3x5 font in PROGMEM, written a column byte at a time straight into the frame buffer,
+// and numbers are formatted with integer division, so nothing pulls in print or its formatting.
+
+namespace debugoverlay
+{
+	// Each column of a glyph is a byte, bit n being row n.
+	// The digits 0 to 9, then a minus sign.
+	const uint8_t glyphs[11][3] PROGMEM
+	{
+		{ 0x1F, 0x11, 0x1F },
+		{ 0x12, 0x1F, 0x10 },
+		{ 0x1D, 0x15, 0x17 },
+		{ 0x15, 0x15, 0x1F },
+		{ 0x07, 0x04, 0x1F },
+		{ 0x17, 0x15, 0x1D },
+		{ 0x1F, 0x15, 0x1D },
+		{ 0x01, 0x01, 0x1F },
+		{ 0x1F, 0x15, 0x1F },
+		{ 0x17, 0x15, 0x1F },
+		{ 0x04, 0x04, 0x04 },
+	};
+
+	constexpr uint8_t minusGlyph = 10;
+
+	constexpr uint8_t glyphWidth = 3;
+
+	// Glyphs are drawn on a black box one pixel bigger on the right and bottom,
+	// so they stay readable over the scene
+	constexpr uint8_t boxMask = 0x3F;
+	constexpr uint8_t advance = (glyphWidth + 1);
+
+	/// The height of a line of numbers, including the gap below it.
+	constexpr uint8_t lineHeight = 6;
+}
+
+/// Keeps up to Capacity numbers to be drawn over the frame.
+/// Once it is full, further numbers are dropped.
+/// Walls are found front to back, so this keeps the nearest.
+template<uint8_t Capacity>
+class DebugOverlay
+{
+private:
+	struct Annotation
+	{
+		// The top left of the number on screen
+		int16_t x;
+		int16_t y;
+
+		int16_t value;
+	};
+
+	Annotation annotations[Capacity];
+	uint8_t count = 0;
+
+public:
+	static constexpr bool isEnabled()
+	{
+		return true;
+	}
+
+	void add(int16_t x, int16_t y, int16_t value)
+	{
+		if(this->count == Capacity)
+			return;
+
+		this->annotations[this->count] = { x, y, value };
+		++this->count;
+	}
+
+	/// Draws every number into the renderer's frame buffer, then forgets them.
+	template<typename Renderer>
+	void draw(Renderer & renderer)
+	{
+		for(uint8_t index = 0; index < this->count; ++index)
+		{
+			const Annotation & annotation = this->annotations[index];
+			drawNumber<Renderer::width(), Renderer::height()>(renderer.getBuffer(), annotation.x, annotation.y, annotation.value);
+		}
+
+		this->count = 0;
+	}
+
+private:
+	template<uint8_t width, uint8_t height>
+	static void drawNumber(uint8_t * buffer, int16_t x, int16_t y, int16_t value)
+	{
+		// Widened so that the most negative value can be negated
+		int32_t remaining = value;
+
+		if(remaining < 0)
+		{
+			drawGlyph<width, height>(buffer, x, y, debugoverlay::minusGlyph);
+			x += debugoverlay::advance;
+			remaining = -remaining;
+		}
+
+		uint8_t digits[5];
+		uint8_t digitCount = 0;
+
+		do
+		{
+			digits[digitCount] = static_cast<uint8_t>(remaining % 10);
+			++digitCount;
+			remaining /= 10;
+		}
+		while(remaining > 0);
+
+		while(digitCount > 0)
+		{
+			--digitCount;
+			drawGlyph<width, height>(buffer, x, y, digits[digitCount]);
+			x += debugoverlay::advance;
+		}
+	}
+
+	template<uint8_t width, uint8_t height>
+	static void drawGlyph(uint8_t * buffer, int16_t x, int16_t y, uint8_t glyph)
+	{
+		for(uint8_t column = 0; column < debugoverlay::glyphWidth; ++column)
+		{
+			const uint8_t bits = pgm_read_byte(&debugoverlay::glyphs[glyph][column]);
+			framebuffer::writeColumn<width, height>(buffer, (x + column), y, bits, debugoverlay::boxMask);
+		}
+
+		framebuffer::writeColumn<width, height>(buffer, (x + debugoverlay::glyphWidth), y, 0, debugoverlay::boxMask);
+	}
+};
+
+/// An overlay that keeps nothing and draws nothing, for builds without debugging.
+struct NullDebugOverlay
+{
+	static constexpr bool isEnabled()
+	{
+		return false;
+	}
+
+	void add(int16_t, int16_t, int16_t)
+	{
+	}
+
+	template<typename Renderer>
+	void draw(Renderer &)
+	{
+	}
+};
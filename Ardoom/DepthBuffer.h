@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "FixedPoints.h"
+
+/// Records how near the wall drawn in each screen column is,
+/// so that things drawn after the walls can be hidden behind them.
+/// Depths are kept as the wall's projected half height, which grows as the wall comes nearer,
+/// to a quarter of a pixel in a byte per column. Columns without a wall are infinitely far away.
+/// Half heights saturate at 63.75 pixels, which the default config's walls only reach at the near plane.
+template<uint8_t Width>
+class DepthBuffer
+{
+private:
+	uint8_t halfHeights[Width];
+
+public:
+	/// Empties every column.
+	void reset()
+	{
+		for(uint8_t x = 0; x < Width; ++x)
+			this->halfHeights[x] = 0;
+	}
+
+	void set(uint8_t x, SQ15x16 halfHeight)
+	{
+		this->halfHeights[x] = toStored(halfHeight);
+	}
+
+	/// Checks whether something of the given projected half height is behind the wall in a column.
+	/// Ties within a quarter of a pixel go to the thing, which is usually standing in front of the wall.
+	bool isHidden(uint8_t x, SQ15x16 halfHeight) const
+	{
+		return (toStored(halfHeight) < this->halfHeights[x]);
+	}
+
+private:
+	// Half heights are 6.2 fixed point, saturating at 63.75
+	static uint8_t toStored(SQ15x16 halfHeight)
+	{
+		const int32_t value = (halfHeight.getInternal() >> (SQ15x16::fractionSize - 2));
+
+		return (value < 0) ? 0 : (value > 0xFF) ? 0xFF : static_cast<uint8_t>(value);
+	}
+};
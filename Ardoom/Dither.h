@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+// Ordered dithering, which shows levels of brightness on the 1-bit screen as patterns of lit pixels.
+// A pixel is lit if its brightness is greater than its threshold in a 4x4 Bayer matrix,
+// which spreads the lit pixels of every level evenly.
+namespace dither
+{
+	/// The number of thresholds, so brightness runs from 0 (never lit) to levelCount (always lit).
+	constexpr uint8_t levelCount = 16;
+
+	// Indexed by row, then column
+	const uint8_t bayer[4][4] PROGMEM
+	{
+		{ 0, 8, 2, 10 },
+		{ 12, 4, 14, 6 },
+		{ 3, 11, 1, 9 },
+		{ 15, 7, 13, 5 },
+	};
+
+	inline uint8_t getThreshold(uint8_t x, uint8_t y)
+	{
+		return pgm_read_byte(&bayer[y % 4][x % 4]);
+	}
+
+	// For each brightness, the pixels of an 8x8 tile that are lit, one byte per column, lowest row first,
+	// lit where an 8x8 Bayer matrix is below four times the brightness.
+	// A byte covers a page of a column of the frame buffer, so filling with a mask costs the same as a solid fill.
+	const uint8_t masks[levelCount + 1][8] PROGMEM
+	{
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+		{ 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00 },
+		{ 0x11, 0x00, 0x44, 0x00, 0x11, 0x00, 0x44, 0x00 },
+		{ 0x11, 0x00, 0x55, 0x00, 0x11, 0x00, 0x55, 0x00 },
+		{ 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00 },
+		{ 0x55, 0x22, 0x55, 0x00, 0x55, 0x22, 0x55, 0x00 },
+		{ 0x55, 0x22, 0x55, 0x88, 0x55, 0x22, 0x55, 0x88 },
+		{ 0x55, 0x22, 0x55, 0xAA, 0x55, 0x22, 0x55, 0xAA },
+		{ 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA },
+		{ 0x55, 0xBB, 0x55, 0xAA, 0x55, 0xBB, 0x55, 0xAA },
+		{ 0x55, 0xBB, 0x55, 0xEE, 0x55, 0xBB, 0x55, 0xEE },
+		{ 0x55, 0xBB, 0x55, 0xFF, 0x55, 0xBB, 0x55, 0xFF },
+		{ 0x55, 0xFF, 0x55, 0xFF, 0x55, 0xFF, 0x55, 0xFF },
+		{ 0x77, 0xFF, 0x55, 0xFF, 0x77, 0xFF, 0x55, 0xFF },
+		{ 0x77, 0xFF, 0xDD, 0xFF, 0x77, 0xFF, 0xDD, 0xFF },
+		{ 0x77, 0xFF, 0xFF, 0xFF, 0x77, 0xFF, 0xFF, 0xFF },
+		{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+	};
+
+	/// Gets the lit pixels of a page of column x at a brightness from 0 to levelCount.
+	inline uint8_t getMask(uint8_t brightness, uint8_t x)
+	{
+		return pgm_read_byte(&masks[brightness][x % 8]);
+	}
+}
\ No newline at end of file
@@ -1,16 +1,40 @@
-#pragma once
-
-#include <avr/pgmspace.h>
-
-#include <stdint.h>
-
-// Temporary data for the sake of testing
-const uint8_t dummyData[] PROGMEM
-{
-	5,
-	10, 0,
-	20, 10,
-	20, 20,
-	0, 20,
-	0, 10,
+#pragma once
+
+#include <avr/pgmspace.h>
+
+#include <stdint.h>
+
+#include "Texture.h"
+
+// Temporary data for the sake of testing
+#include "DummyLevel.h"
+
+// Bricks, with the width and height first
+const uint8_t dummyTexture[] PROGMEM
+{
+	16, 16,
+	0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+	0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+};
+
+// A barrel, with the width and height first
+const uint8_t dummySpriteImage[] PROGMEM
+{
+	8, 16,
+	0xFE, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xFE,
+	0x7F, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7F,
+};
+
+// Where the barrel is drawn, with the width and height first
+const uint8_t dummySpriteMask[] PROGMEM
+{
+	8, 16,
+	0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+};
+
+// The sprite of each type of entity
+const MaskedSprite dummySprites[]
+{
+	{ ProgmemTexture(dummySpriteImage), ProgmemTexture(dummySpriteMask) },
 };
\ No newline at end of file
@@ -1,9 +1,9 @@
-#pragma once
-
-#include "Geometry.h"
-
-class Entity
-{
-public:
-	Point2F position;
+#pragma once
+
+#include "Geometry.h"
+
+class Entity
+{
+public:
+	Point2SQ15x16 position;
 };
\ No newline at end of file
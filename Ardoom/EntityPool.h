@@ -0,0 +1,281 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Geometry.h"
+#include "Traits.h"
+
+/// A fixed number of entities, stored without the heap as one array per field.
+/// Live entities are kept packed at the front of the arrays,
+/// so batch updates run straight through them and never visit a dead slot.
+/// Destroying an entity moves the last live entity into its place,
+/// so entities are referred to by handles, which look up where an entity is now.
+/// Handles come from a free list of slots, and each slot counts how often it's been freed,
+/// so a handle to a destroyed entity stays dead even once its slot is reused.
+/// The count wraps after 256 reuses of one slot, which a handle kept that long could mistake for its own.
+template<uint16_t Capacity>
+class EntityPool
+{
+private:
+	// Small pools use byte indices, which halves the bookkeeping on device
+	using Index = traits::conditional_t<(Capacity < 0xFF), uint8_t, uint16_t>;
+
+	static_assert(Capacity > 0, "An entity pool needs at least one entity");
+	static_assert(Capacity < 0xFFFF, "Capacity is too large for a 16 bit index");
+
+public:
+	struct Handle
+	{
+		Index slot;
+		uint8_t generation;
+	};
+
+	/// A handle that never refers to a live entity.
+	static constexpr Handle noHandle()
+	{
+		return { static_cast<Index>(~Index(0)), 0 };
+	}
+
+	static constexpr uint16_t getCapacity()
+	{
+		return Capacity;
+	}
+
+private:
+	// The live entities, packed from index 0
+	Point2SQ15x16 positions[Capacity];
+	Vector2SQ15x16 velocities[Capacity];
+	uint8_t types[Capacity];
+	uint8_t states[Capacity];
+
+	// The slot of each live entity
+	Index slots[Capacity];
+
+	// Where each slot's entity is, or if the slot is free, the next free slot
+	Index entries[Capacity];
+	uint8_t generations[Capacity] {};
+
+	Index firstFree = 0;
+	Index count = 0;
+
+	// Whether anything that can be seen has changed since checkChanged was last called
+	bool changed = false;
+
+public:
+	EntityPool()
+	{
+		this->clear();
+	}
+
+	/// Destroys every entity, invalidating every handle.
+	void clear()
+	{
+		if(this->count > 0)
+			this->changed = true;
+
+		// Ends the handles to the live entities
+		for(Index index = 0; index < this->count; ++index)
+			++this->generations[this->slots[index]];
+
+		for(uint16_t slot = 0; slot < Capacity; ++slot)
+			this->entries[slot] = static_cast<Index>(slot + 1);
+
+		this->firstFree = 0;
+		this->count = 0;
+	}
+
+	uint16_t getCount() const
+	{
+		return this->count;
+	}
+
+	bool isFull() const
+	{
+		return (this->count == Capacity);
+	}
+
+	/// Checks whether an entity has been created, destroyed, moved or had its state changed
+	/// since the last call, for knowing when they have to be drawn again.
+	/// Velocities can't be seen, so changing them doesn't count until the entity moves.
+	bool checkChanged()
+	{
+		const bool result = this->changed;
+		this->changed = false;
+		return result;
+	}
+
+	/// Adds an entity. Returns noHandle if the pool is full.
+	Handle create(const Point2SQ15x16 & position, const Vector2SQ15x16 & velocity, uint8_t type, uint8_t state = 0)
+	{
+		if(this->isFull())
+			return noHandle();
+
+		const Index slot = this->firstFree;
+		this->firstFree = this->entries[slot];
+
+		const Index index = this->count;
+		++this->count;
+
+		this->entries[slot] = index;
+		this->slots[index] = slot;
+
+		this->positions[index] = position;
+		this->velocities[index] = velocity;
+		this->types[index] = type;
+		this->states[index] = state;
+
+		this->changed = true;
+
+		return { slot, this->generations[slot] };
+	}
+
+	/// Removes an entity. Returns false if it was already dead.
+	bool destroy(Handle handle)
+	{
+		if(!this->isAlive(handle))
+			return false;
+
+		this->removeAt(this->entries[handle.slot]);
+		return true;
+	}
+
+	bool isAlive(Handle handle) const
+	{
+		return ((handle.slot < Capacity) && (this->generations[handle.slot] == handle.generation) && this->isLiveSlot(handle.slot));
+	}
+
+	// The accessors below take handles to live entities
+
+	const Point2SQ15x16 & getPosition(Handle handle) const
+	{
+		return this->positions[this->entries[handle.slot]];
+	}
+
+	void setPosition(Handle handle, const Point2SQ15x16 & position)
+	{
+		this->positions[this->entries[handle.slot]] = position;
+		this->changed = true;
+	}
+
+	const Vector2SQ15x16 & getVelocity(Handle handle) const
+	{
+		return this->velocities[this->entries[handle.slot]];
+	}
+
+	void setVelocity(Handle handle, const Vector2SQ15x16 & velocity)
+	{
+		this->velocities[this->entries[handle.slot]] = velocity;
+	}
+
+	uint8_t getType(Handle handle) const
+	{
+		return this->types[this->entries[handle.slot]];
+	}
+
+	uint8_t getState(Handle handle) const
+	{
+		return this->states[this->entries[handle.slot]];
+	}
+
+	void setState(Handle handle, uint8_t state)
+	{
+		this->states[this->entries[handle.slot]] = state;
+		this->changed = true;
+	}
+
+	// The fields of the live entities, getCount() long, in no particular order
+
+	const Point2SQ15x16 * getPositions() const
+	{
+		return this->positions;
+	}
+
+	const Vector2SQ15x16 * getVelocities() const
+	{
+		return this->velocities;
+	}
+
+	const uint8_t * getTypes() const
+	{
+		return this->types;
+	}
+
+	const uint8_t * getStates() const
+	{
+		return this->states;
+	}
+
+	/// Moves every live entity by its velocity.
+	void move()
+	{
+		for(Index index = 0; index < this->count; ++index)
+		{
+			const Vector2SQ15x16 & velocity = this->velocities[index];
+
+			// Entities standing still don't count as changes
+			if((velocity.x != 0) || (velocity.y != 0))
+			{
+				this->positions[index] += velocity;
+				this->changed = true;
+			}
+		}
+	}
+
+	/// Calls update(position, velocity, type, state) for every live entity,
+	/// which may change anything but the type, so every entity counts as changed.
+	template<typename Update>
+	void update(Update update)
+	{
+		if(this->count > 0)
+			this->changed = true;
+
+		for(Index index = 0; index < this->count; ++index)
+			update(this->positions[index], this->velocities[index], this->types[index], this->states[index]);
+	}
+
+	/// Destroys every live entity for which predicate(position, velocity, type, state) is true.
+	template<typename Predicate>
+	void destroyIf(Predicate predicate)
+	{
+		// Backwards, so the entity moved into a hole has already been visited
+		for(Index index = this->count; index > 0; --index)
+		{
+			const Index current = (index - 1);
+
+			if(predicate(this->positions[current], this->velocities[current], this->types[current], this->states[current]))
+				this->removeAt(current);
+		}
+	}
+
+private:
+	bool isLiveSlot(Index slot) const
+	{
+		const Index index = this->entries[slot];
+		return ((index < this->count) && (this->slots[index] == slot));
+	}
+
+	// Removes the live entity at an index, filling the hole with the last live entity
+	void removeAt(Index index)
+	{
+		const Index slot = this->slots[index];
+		const Index last = (this->count - 1);
+
+		if(index != last)
+		{
+			this->positions[index] = this->positions[last];
+			this->velocities[index] = this->velocities[last];
+			this->types[index] = this->types[last];
+			this->states[index] = this->states[last];
+
+			this->slots[index] = this->slots[last];
+			this->entries[this->slots[index]] = index;
+		}
+
+		--this->count;
+		this->changed = true;
+
+		++this->generations[slot];
+		this->entries[slot] = this->firstFree;
+		this->firstFree = slot;
+	}
+};
\ No newline at end of file
@@ -0,0 +1 @@
+#include "FixedPoints/FixedPoints.h"
\ No newline at end of file
@@ -0,0 +1,2 @@
+#include "SFixed.h"
+#include "SFixedAliases.h"
\ No newline at end of file
@@ -0,0 +1,261 @@
+#pragma once
+
+// For int8_t, int16_t, int32_t, int64_t
+#include <stdint.h>
+
+// For conditional_t, enable_if_t, is_integral, is_floating_point, is_fixed_point
+#include "../Traits.h"
+
+namespace details
+{
+	/// The smallest signed integer type with at least the given number of bits.
+	template<unsigned bits>
+	using LeastInt =
+		traits::conditional_t<(bits <= 8), int8_t,
+		traits::conditional_t<(bits <= 16), int16_t,
+		traits::conditional_t<(bits <= 32), int32_t,
+		int64_t>>>;
+
+	template<bool widen>
+	struct FractionConverter;
+
+	template<>
+	struct FractionConverter<true>
+	{
+		template<typename Result, typename Type>
+		static constexpr Result convert(Type value, unsigned shift)
+		{
+			return static_cast<Result>(static_cast<Result>(value) * (static_cast<Result>(1) << shift));
+		}
+	};
+
+	template<>
+	struct FractionConverter<false>
+	{
+		template<typename Result, typename Type>
+		static constexpr Result convert(Type value, unsigned shift)
+		{
+			return static_cast<Result>(value >> shift);
+		}
+	};
+}
+
+/// A signed fixed point number.
+/// Has a sign bit, IntegerSize integer bits and FractionSize fractional bits.
+template<unsigned IntegerSize, unsigned FractionSize>
+class SFixed
+{
+public:
+	static constexpr unsigned integerSize = IntegerSize;
+	static constexpr unsigned fractionSize = FractionSize;
+	static constexpr unsigned logicalSize = (IntegerSize + FractionSize + 1);
+
+	using InternalType = details::LeastInt<logicalSize>;
+	using IntermediateType = details::LeastInt<(logicalSize * 2)>;
+	using IntegerType = details::LeastInt<(IntegerSize + 1)>;
+
+	/// The internal value that represents 1.
+	static constexpr InternalType scale = static_cast<InternalType>(static_cast<IntermediateType>(1) << FractionSize);
+
+private:
+	struct RawTag {};
+
+	InternalType value;
+
+	constexpr SFixed(RawTag, InternalType value) :
+		value { value }
+	{
+	}
+
+public:
+	SFixed() = default;
+
+	/// Converts an integer to a fixed point number.
+	template<typename Integer, traits::enable_if_t<traits::is_integral<Integer>::value, int> = 0>
+	constexpr SFixed(Integer integer) :
+		value { static_cast<InternalType>(static_cast<InternalType>(integer) * scale) }
+	{
+	}
+
+	/// Converts a float to a fixed point number.
+	/// Intended for constants, which the compiler folds away.
+	constexpr SFixed(float value) :
+		value { static_cast<InternalType>(value * scale) }
+	{
+	}
+
+	/// Converts a double to a fixed point number.
+	/// Intended for constants, which the compiler folds away.
+	constexpr SFixed(double value) :
+		value { static_cast<InternalType>(value * scale) }
+	{
+	}
+
+	/// Converts another kind of SFixed to this kind of SFixed.
+	template<unsigned OtherIntegerSize, unsigned OtherFractionSize>
+	explicit constexpr SFixed(const SFixed<OtherIntegerSize, OtherFractionSize> & other) :
+		value
+		{
+			details::FractionConverter<(FractionSize >= OtherFractionSize)>::template convert<InternalType>
+			(
+				other.getInternal(),
+				(FractionSize >= OtherFractionSize) ? (FractionSize - OtherFractionSize) : (OtherFractionSize - FractionSize)
+			)
+		}
+	{
+	}
+
+	/// Creates a fixed point number from its internal representation.
+	static constexpr SFixed fromInternal(InternalType value)
+	{
+		return SFixed(RawTag(), value);
+	}
+
+	/// Gets the internal representation.
+	constexpr InternalType getInternal() const
+	{
+		return this->value;
+	}
+
+	/// Gets the integer part, rounded towards negative infinity.
+	constexpr IntegerType getInteger() const
+	{
+		return static_cast<IntegerType>(this->value >> FractionSize);
+	}
+
+	/// Converts to an integer, rounding towards negative infinity.
+	template<typename Integer, traits::enable_if_t<traits::is_integral<Integer>::value, int> = 0>
+	explicit constexpr operator Integer() const
+	{
+		return static_cast<Integer>(this->value >> FractionSize);
+	}
+
+	explicit constexpr operator float() const
+	{
+		return (static_cast<float>(this->value) / scale);
+	}
+
+	explicit constexpr operator double() const
+	{
+		return (static_cast<double>(this->value) / scale);
+	}
+
+	SFixed & operator +=(SFixed other)
+	{
+		this->value += other.value;
+		return *this;
+	}
+
+	SFixed & operator -=(SFixed other)
+	{
+		this->value -= other.value;
+		return *this;
+	}
+
+	SFixed & operator *=(SFixed other)
+	{
+		return (*this = (*this * other));
+	}
+
+	SFixed & operator /=(SFixed other)
+	{
+		return (*this = (*this / other));
+	}
+
+	friend constexpr bool operator ==(SFixed left, SFixed right)
+	{
+		return (left.value == right.value);
+	}
+
+	friend constexpr bool operator !=(SFixed left, SFixed right)
+	{
+		return (left.value != right.value);
+	}
+
+	friend constexpr bool operator <(SFixed left, SFixed right)
+	{
+		return (left.value < right.value);
+	}
+
+	friend constexpr bool operator <=(SFixed left, SFixed right)
+	{
+		return (left.value <= right.value);
+	}
+
+	friend constexpr bool operator >(SFixed left, SFixed right)
+	{
+		return (left.value > right.value);
+	}
+
+	friend constexpr bool operator >=(SFixed left, SFixed right)
+	{
+		return (left.value >= right.value);
+	}
+
+	friend constexpr SFixed operator -(SFixed value)
+	{
+		return fromInternal(static_cast<InternalType>(-value.value));
+	}
+
+	friend constexpr SFixed operator +(SFixed left, SFixed right)
+	{
+		return fromInternal(static_cast<InternalType>(left.value + right.value));
+	}
+
+	friend constexpr SFixed operator -(SFixed left, SFixed right)
+	{
+		return fromInternal(static_cast<InternalType>(left.value - right.value));
+	}
+
+	friend constexpr SFixed operator *(SFixed left, SFixed right)
+	{
+		return fromInternal(static_cast<InternalType>((static_cast<IntermediateType>(left.value) * right.value) >> FractionSize));
+	}
+
+	friend constexpr SFixed operator /(SFixed left, SFixed right)
+	{
+		return fromInternal(static_cast<InternalType>((static_cast<IntermediateType>(left.value) * scale) / right.value));
+	}
+
+	/// Gets the square root of a fixed point number.
+	/// Negative numbers produce 0.
+	friend SFixed sqrt(SFixed value)
+	{
+		if(value.value <= 0)
+			return fromInternal(0);
+
+		// The radicand is scaled twice so that the root is scaled once
+		IntermediateType remainder = (static_cast<IntermediateType>(value.value) * scale);
+		IntermediateType result = 0;
+		IntermediateType bit = (static_cast<IntermediateType>(1) << ((sizeof(IntermediateType) * 8) - 2));
+
+		while(bit > remainder)
+			bit >>= 2;
+
+		while(bit != 0)
+		{
+			if(remainder >= (result + bit))
+			{
+				remainder -= (result + bit);
+				result = ((result >> 1) + bit);
+			}
+			else
+			{
+				result >>= 1;
+			}
+
+			bit >>= 2;
+		}
+
+		return fromInternal(static_cast<InternalType>(result));
+	}
+};
+
+template<unsigned IntegerSize, unsigned FractionSize>
+constexpr typename SFixed<IntegerSize, FractionSize>::InternalType SFixed<IntegerSize, FractionSize>::scale;
+
+namespace traits
+{
+	template<unsigned IntegerSize, unsigned FractionSize>
+	struct is_fixed_point<SFixed<IntegerSize, FractionSize>> : true_type {};
+}
\ No newline at end of file
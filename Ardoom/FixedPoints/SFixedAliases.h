@@ -0,0 +1,9 @@
+#pragma once
+
+#include "SFixed.h"
+
+/// Q8.8 - 8 integer bits (including the sign bit) and 8 fractional bits
+using SQ7x8 = SFixed<7, 8>;
+
+/// Q16.16 - 16 integer bits (including the sign bit) and 16 fractional bits
+using SQ15x16 = SFixed<15, 16>;
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "FixedPoints.h"
+#include "Dither.h"
+
+/// The dither pattern of the floor and ceiling in each page of a column of the screen.
+/// The depth of the flat seen in a row depends only on the row and on how far the flat is above or below the eye,
+/// and so does its brightness.
+/// The patterns repeat every four columns, so they are worked out for a sector's floor and ceiling heights and its light,
+/// and flats are then filled a byte at a time.
+/// Sectors that are alike share the patterns, so levels with few heights and lights rarely work them out again.
+template<uint8_t Height>
+class FlatShading
+{
+private:
+	// Indexed by column, then page
+	uint8_t patterns[4][Height / 8];
+
+	uint16_t projectionScale;
+
+	// The sector that the patterns were worked out for
+	SQ15x16 ceiling;
+	SQ15x16 floor;
+	uint8_t light;
+	bool isCurrent = false;
+
+public:
+	static constexpr bool isEnabled()
+	{
+		return true;
+	}
+
+	/// Starts a frame.
+	void update(uint16_t projectionScale)
+	{
+		this->projectionScale = projectionScale;
+		this->isCurrent = false;
+	}
+
+	/// Works out the patterns for a ceiling the given height above the eye and a floor the given height below it,
+	/// of the given brightness at a depth of 1 (out of dither::levelCount), which grow darker as they get further away,
+	/// unless they're already the current ones.
+	void setSector(SQ15x16 ceiling, SQ15x16 floor, uint8_t light)
+	{
+		if(this->isCurrent && (ceiling == this->ceiling) && (floor == this->floor) && (light == this->light))
+			return;
+
+		this->ceiling = ceiling;
+		this->floor = floor;
+		this->light = light;
+		this->isCurrent = true;
+
+		const SQ15x16 ceilingFactor = this->getFactor(ceiling);
+		const SQ15x16 floorFactor = this->getFactor(floor);
+
+		for(uint8_t page = 0; page < (Height / 8); ++page)
+		{
+			uint8_t columnPatterns[4] {};
+
+			for(uint8_t bit = 0; bit < 8; ++bit)
+			{
+				const uint8_t y = ((page * 8) + bit);
+
+				// Twice the offset of the row's centre from the centre of the screen, which is never 0
+				const int16_t doubleOffset = (((2 * y) + 1) - Height);
+
+				const uint16_t brightness = (doubleOffset < 0) ?
+					static_cast<uint16_t>(ceilingFactor * static_cast<uint8_t>(-doubleOffset)) :
+					static_cast<uint16_t>(floorFactor * static_cast<uint8_t>(doubleOffset));
+
+				for(uint8_t column = 0; column < 4; ++column)
+					if(brightness > dither::getThreshold(column, y))
+						columnPatterns[column] |= (1 << bit);
+			}
+
+			for(uint8_t column = 0; column < 4; ++column)
+				this->patterns[column][page] = columnPatterns[column];
+		}
+	}
+
+	/// Gets the pattern of each page for a column of the screen.
+	const uint8_t * getPatterns(uint8_t x) const
+	{
+		return this->patterns[x % 4];
+	}
+
+private:
+	// A flat 'height' from the eye, seen in a row 'offset' rows from the centre of the screen,
+	// is at a depth of ((height * projectionScale) / offset),
+	// so its brightness, light / depth, is the offset times a factor of the height.
+	// The factor is taken per doubled offset, which keeps the offset of a row's centre whole.
+	// Flats on the far side of the eye can't be seen, and are left dark.
+	SQ15x16 getFactor(SQ15x16 height) const
+	{
+		if(height <= 0)
+			return 0;
+
+		// Divided one at a time, as their product can overflow
+		return ((SQ15x16(this->light) / this->projectionScale) / (height * 2));
+	}
+};
+
+/// Shading for renderers that don't draw flats.
+struct NullFlatShading
+{
+	static constexpr bool isEnabled()
+	{
+		return false;
+	}
+
+	void update(uint16_t)
+	{
+	}
+
+	void setSector(SQ15x16, SQ15x16, uint8_t)
+	{
+	}
+
+	const uint8_t * getPatterns(uint8_t) const
+	{
+		return nullptr;
+	}
+};
\ No newline at end of file
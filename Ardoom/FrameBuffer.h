@@ -0,0 +1,288 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Profiler.h"
+
+// The Arduboy's frame buffer is laid out in pages for the SSD1306:
+// each byte is a column of 8 rows, the least significant bit at the top,
+// and each run of 'width' bytes is a page of 8 rows.
+namespace framebuffer
+{
+	/// Fills the rows of a column from top (inclusive) to bottom (exclusive) with a pattern.
+	/// Bit n of the pattern is used for the rows in the nth row of each page.
+	/// Writes one byte per page, masking only the first and last.
+	template<uint8_t width>
+	void fillColumn(uint8_t * buffer, uint8_t x, uint8_t top, uint8_t bottom, uint8_t pattern)
+	{
+		if(top >= bottom)
+			return;
+
+		profiler::count(profiler::Counter::PixelsWritten, (bottom - top));
+
+		const uint8_t last = (bottom - 1);
+
+		const uint8_t firstPage = (top / 8);
+		const uint8_t lastPage = (last / 8);
+
+		const uint8_t headMask = static_cast<uint8_t>(0xFF << (top % 8));
+		const uint8_t tailMask = static_cast<uint8_t>(0xFF >> (7 - (last % 8)));
+
+		uint8_t * pointer = &buffer[(firstPage * width) + x];
+
+		if(firstPage == lastPage)
+		{
+			const uint8_t mask = (headMask & tailMask);
+			*pointer = ((*pointer & ~mask) | (pattern & mask));
+			return;
+		}
+
+		*pointer = ((*pointer & ~headMask) | (pattern & headMask));
+		pointer += width;
+
+		for(uint8_t page = (firstPage + 1); page < lastPage; ++page)
+		{
+			*pointer = pattern;
+			pointer += width;
+		}
+
+		*pointer = ((*pointer & ~tailMask) | (pattern & tailMask));
+	}
+
+	/// Fills the rows of a column from top (inclusive) to bottom (exclusive) with a pattern for each page,
+	/// patterns[n] being used in page n, as fillColumn does with a single pattern.
+	template<uint8_t width>
+	void fillColumnPages(uint8_t * buffer, uint8_t x, uint8_t top, uint8_t bottom, const uint8_t * patterns)
+	{
+		if(top >= bottom)
+			return;
+
+		profiler::count(profiler::Counter::PixelsWritten, (bottom - top));
+
+		const uint8_t last = (bottom - 1);
+
+		const uint8_t firstPage = (top / 8);
+		const uint8_t lastPage = (last / 8);
+
+		const uint8_t headMask = static_cast<uint8_t>(0xFF << (top % 8));
+		const uint8_t tailMask = static_cast<uint8_t>(0xFF >> (7 - (last % 8)));
+
+		uint8_t * pointer = &buffer[(firstPage * width) + x];
+
+		if(firstPage == lastPage)
+		{
+			const uint8_t mask = (headMask & tailMask);
+			*pointer = ((*pointer & ~mask) | (patterns[firstPage] & mask));
+			return;
+		}
+
+		*pointer = ((*pointer & ~headMask) | (patterns[firstPage] & headMask));
+		pointer += width;
+
+		for(uint8_t page = (firstPage + 1); page < lastPage; ++page)
+		{
+			*pointer = patterns[page];
+			pointer += width;
+		}
+
+		*pointer = ((*pointer & ~tailMask) | (patterns[lastPage] & tailMask));
+	}
+
+	/// Writes up to 8 rows of a column starting at row y, which may be off screen:
+	/// the rows in 'mask' are cleared, then those in 'bits' are set.
+	/// Bit n of each is row (y + n), so a byte of bits straddles at most two pages.
+	template<uint8_t width, uint8_t height>
+	void writeColumn(uint8_t * buffer, int16_t x, int16_t y, uint8_t bits, uint8_t mask)
+	{
+		if((x < 0) || (x >= width) || (y <= -8) || (y >= height))
+			return;
+
+		// Rounded down, so the rows above the screen are in page -1
+		const int8_t page = static_cast<int8_t>(((y + 8) / 8) - 1);
+		const uint8_t shift = static_cast<uint8_t>(y & 7);
+
+		if(page >= 0)
+		{
+			uint8_t & byte = buffer[(page * width) + x];
+			byte = ((byte & ~static_cast<uint8_t>(mask << shift)) | static_cast<uint8_t>(bits << shift));
+		}
+
+		if((shift != 0) && ((page + 1) < (height / 8)))
+		{
+			uint8_t & byte = buffer[((page + 1) * width) + x];
+			byte = ((byte & ~static_cast<uint8_t>(mask >> (8 - shift))) | static_cast<uint8_t>(bits >> (8 - shift)));
+		}
+	}
+
+	/// Sets the pixels of a line from (x0, y0) to (x1, y1) inclusive,
+	/// choosing the same pixels as the Arduboy2 library's Bresenham drawLine.
+	/// The line is clipped to the screen once, up front, at exactly the steps where it enters and leaves,
+	/// then stepped with a pointer and bit mask into the buffer.
+	/// Pixels of steep lines that share a byte are written together.
+	/// As in the library, the distance between the ends must fit in an int16_t.
+	template<uint8_t width, uint8_t height>
+	void drawLine(uint8_t * buffer, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+	{
+		// Step along the major axis, which is x after swapping steep lines
+		const bool steep = (((y1 > y0) ? (y1 - y0) : (y0 - y1)) > ((x1 > x0) ? (x1 - x0) : (x0 - x1)));
+
+		if(steep)
+		{
+			int16_t temporary = x0;
+			x0 = y0;
+			y0 = temporary;
+
+			temporary = x1;
+			x1 = y1;
+			y1 = temporary;
+		}
+
+		if(x0 > x1)
+		{
+			int16_t temporary = x0;
+			x0 = x1;
+			x1 = temporary;
+
+			temporary = y0;
+			y0 = y1;
+			y1 = temporary;
+		}
+
+		const int16_t majorLimit = steep ? height : width;
+		const int16_t minorLimit = steep ? width : height;
+
+		const int16_t deltaX = (x1 - x0);
+		const int16_t deltaY = ((y1 > y0) ? (y1 - y0) : (y0 - y1));
+		const int8_t stepY = ((y0 < y1) ? 1 : -1);
+		const int16_t halfDeltaX = (deltaX / 2);
+
+		// After i steps, y has moved ceil(((i * deltaY) - halfDeltaX) / deltaX) times,
+		// so the steps where the line enters and leaves the screen can be solved for directly
+		int32_t firstStep = (x0 < 0) ? -static_cast<int32_t>(x0) : 0;
+		int32_t lastStep = ((x1 < majorLimit) ? x1 : (majorLimit - 1)) - static_cast<int32_t>(x0);
+
+		// The number of times y must move to reach the first and last visible rows
+		const int32_t firstMove = (stepY > 0) ? -static_cast<int32_t>(y0) : (static_cast<int32_t>(y0) - (minorLimit - 1));
+		const int32_t lastMove = (stepY > 0) ? ((minorLimit - 1) - static_cast<int32_t>(y0)) : static_cast<int32_t>(y0);
+
+		if(lastMove < 0)
+			return;
+
+		if(firstMove > 0)
+		{
+			if(deltaY == 0)
+				return;
+
+			const int32_t step = (((halfDeltaX + ((firstMove - 1) * static_cast<int32_t>(deltaX))) / deltaY) + 1);
+			firstStep = (step > firstStep) ? step : firstStep;
+		}
+
+		if(deltaY != 0)
+		{
+			const int32_t step = ((halfDeltaX + (lastMove * static_cast<int32_t>(deltaX))) / deltaY);
+			lastStep = (step < lastStep) ? step : lastStep;
+		}
+
+		if(firstStep > lastStep)
+			return;
+
+		const int32_t moves = (deltaX > 0) ? ((((firstStep * deltaY) - halfDeltaX) + (deltaX - 1)) / deltaX) : 0;
+
+		int16_t error = static_cast<int16_t>((halfDeltaX - (firstStep * deltaY)) + (moves * deltaX));
+		uint8_t remaining = static_cast<uint8_t>(lastStep - firstStep);
+
+		profiler::count(profiler::Counter::PixelsWritten, (remaining + 1));
+
+		const uint8_t major = static_cast<uint8_t>(x0 + firstStep);
+		const uint8_t minor = static_cast<uint8_t>(y0 + (stepY * moves));
+
+		const uint8_t x = steep ? minor : major;
+		const uint8_t y = steep ? major : minor;
+
+		uint8_t * pointer = &buffer[((y / 8) * width) + x];
+		uint8_t mask = static_cast<uint8_t>(1 << (y % 8));
+
+		if(steep)
+		{
+			// Each step moves down a row, so bits are gathered until the line leaves the byte
+			uint8_t bits = 0;
+
+			while(true)
+			{
+				bits |= mask;
+
+				if(remaining == 0)
+					break;
+
+				--remaining;
+
+				mask = static_cast<uint8_t>(mask << 1);
+				error -= deltaY;
+
+				const bool moved = (error < 0);
+
+				if(moved)
+					error += deltaX;
+
+				if(moved || (mask == 0))
+				{
+					*pointer |= bits;
+					bits = 0;
+
+					if(mask == 0)
+					{
+						mask = 1;
+						pointer += width;
+					}
+
+					if(moved)
+						pointer += stepY;
+				}
+			}
+
+			*pointer |= bits;
+		}
+		else
+		{
+			// Each step moves right a column, so every pixel is in a different byte
+			while(true)
+			{
+				*pointer |= mask;
+
+				if(remaining == 0)
+					break;
+
+				--remaining;
+
+				++pointer;
+				error -= deltaY;
+
+				if(error < 0)
+				{
+					error += deltaX;
+
+					if(stepY > 0)
+					{
+						mask = static_cast<uint8_t>(mask << 1);
+
+						if(mask == 0)
+						{
+							mask = 1;
+							pointer += width;
+						}
+					}
+					else
+					{
+						mask = static_cast<uint8_t>(mask >> 1);
+
+						if(mask == 0)
+						{
+							mask = 0x80;
+							pointer -= width;
+						}
+					}
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -1,52 +1,162 @@
-#include "Game.h"
-
-#include "Utils.h"
-#include "Geometry.h"
-#include "Constants.h"
-
-#include "SectorRenderer.h"
-
-void Game::update()
-{
-	const Vector2F cameraDirection { cos(camera.angle), sin(camera.angle) };
-
-	if(this->arduboy.pressed(UP_BUTTON))
-	{
-		camera.position += cameraDirection;
-	}
-
-	if(this->arduboy.pressed(DOWN_BUTTON))
-	{
-		camera.position -= cameraDirection;
-	}
-
-	constexpr float quarterTurn = (constants::Tau<float>::value / 4);
-
-	if(this->arduboy.pressed(LEFT_BUTTON))
-	{
-		const Vector2F left { cos(camera.angle - quarterTurn), sin(camera.angle - quarterTurn) };
-		camera.position += left;
-	}
-
-	if(this->arduboy.pressed(RIGHT_BUTTON))
-	{
-		const Vector2F right { cos(camera.angle + quarterTurn), sin(camera.angle + quarterTurn) };
-		camera.position += right;
-	}
-
-	if(this->arduboy.pressed(A_BUTTON))
-	{
-		camera.angle -= 0.1;
-	}
-
-	if(this->arduboy.pressed(B_BUTTON))
-	{
-		camera.angle += 0.1;
-	}
-}
-
-void Game::render()
-{
-	SectorRenderer<Arduboy2>::render3D(this->arduboy, this->camera, this->dummySector);
-	SectorRenderer<Arduboy2>::render2D(this->arduboy, this->camera, this->dummySector);
+#include "Game.h"
+
+#include "Utils.h"
+#include "Geometry.h"
+#include "Constants.h"
+
+#include "SectorRenderer.h"
+#include "SpriteRenderer.h"
+
+namespace
+{
+	// Walls are shaded by their distance, over a dithered floor and ceiling,
+	// and the map's lines are drawn straight into the frame buffer
+	struct GameRendererConfig : DefaultSectorRendererConfig
+	{
+		using WallPolicy = ShadedWallPolicy;
+		using LinePolicy = FrameBufferLinePolicy;
+
+		static constexpr bool areFlatsDrawn()
+		{
+			return true;
+		}
+
+		// A slot for every point of the level, as Game's transform cache has
+		static constexpr uint16_t vertexCacheCapacity()
+		{
+			return dummyLevelPointCount;
+		}
+	};
+
+	using GameRenderer = SectorRenderer<Arduboy2, GameRendererConfig>;
+	using GameSpriteRenderer = SpriteRenderer<Arduboy2, GameRendererConfig>;
+}
+
+void Game::update()
+{
+	const profiler::ScopedTimer timer { profiler::Stage::Update };
+
+	const Vector2SQ15x16 & forward = camera.getForward();
+	const Vector2SQ15x16 & right = camera.getRight();
+
+	const Point2SQ15x16 previousPosition = camera.position;
+
+	if(this->arduboy.pressed(UP_BUTTON))
+	{
+		camera.position += forward;
+	}
+
+	if(this->arduboy.pressed(DOWN_BUTTON))
+	{
+		camera.position -= forward;
+	}
+
+	if(this->arduboy.pressed(LEFT_BUTTON))
+	{
+		camera.position -= right;
+	}
+
+	if(this->arduboy.pressed(RIGHT_BUTTON))
+	{
+		camera.position += right;
+	}
+
+	// Four steps of the trig tables, about 0.1 radians
+	constexpr BinaryAngleU16 turnSpeed { 1024 };
+
+	if(this->arduboy.pressed(A_BUTTON))
+	{
+		camera.rotate(-turnSpeed);
+	}
+
+	if(this->arduboy.pressed(B_BUTTON))
+	{
+		camera.rotate(turnSpeed);
+	}
+
+	this->entities.move();
+
+	// Keep the camera inside the level, tracking which sector it's in
+	const SectorId sector = this->level.findSector(camera.position, camera.sector);
+
+	if(this->canEnter(sector))
+	{
+		camera.sector = sector;
+		this->standOnFloor();
+	}
+	else
+	{
+		camera.position = previousPosition;
+	}
+}
+
+bool Game::canEnter(SectorId sector) const
+{
+	if(sector == noSector)
+		return false;
+
+	if(sector == this->camera.sector)
+		return true;
+
+	const Sector current = this->level.getSector(this->camera.sector);
+	const Sector next = this->level.getSector(sector);
+
+	// Steps too high to climb, and ceilings too low to stand under, block the way like walls
+	const SQ15x16 floorHeight { next.getFloorHeight() };
+	const SQ15x16 ceilingHeight { next.getCeilingHeight() };
+
+	return ((floorHeight <= (SQ15x16(current.getFloorHeight()) + maxStepHeight())) && ((ceilingHeight - floorHeight) > eyeHeight()));
+}
+
+void Game::standOnFloor()
+{
+	this->camera.height = (SQ15x16(this->level.getSector(this->camera.sector).getFloorHeight()) + eyeHeight());
+}
+
+bool Game::isSceneChanged()
+{
+	if(this->entities.checkChanged())
+		this->sceneTracker.invalidate();
+
+	// The profiler's overlay changes as it measures, and there's nothing to measure in a skipped frame
+	if(profiler::isEnabled())
+		return true;
+
+	return this->sceneTracker.isChanged(this->camera);
+}
+
+void Game::render()
+{
+	DepthBuffer<Arduboy2::width()> depthBuffer;
+
+	const CullStatistics statistics = GameRenderer::render3D(this->arduboy, this->camera, this->level, GameRendererConfig::WallPolicy(), &depthBuffer, &this->transformCache);
+	profiler::count(profiler::Counter::WallsCulled, (statistics.walls - statistics.getProjected()));
+
+	GameSpriteRenderer::render(this->arduboy, this->camera, this->level, this->entities, dummySprites, depthBuffer);
+
+	GameRenderer::render2D(this->arduboy, this->camera, this->level);
+
+	// The last complete window's results, over the top of the frame
+	this->arduboy.setCursor(0, 0);
+	profiler::printOverlay(this->arduboy);
+}
+
+void Game::clear()
+{
+	const profiler::ScopedTimer timer { profiler::Stage::Clear };
+
+	this->arduboy.clear();
+}
+
+void Game::display()
+{
+	const profiler::ScopedTimer timer { profiler::Stage::Display };
+
+	this->arduboy.display();
+}
+
+void Game::endFrame()
+{
+	if(profiler::endFrame())
+		profiler::printTable(Serial);
 }
\ No newline at end of file
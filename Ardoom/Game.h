@@ -1,58 +1,123 @@
-#pragma once
-
-#include <Arduboy2.h>
-
-#include "GameState.h"
-#include "Entity.h"
-#include "Camera.h"
-#include "Sector.h"
-#include "DummyData.h"
-
-class Game
-{
-private:
-	Arduboy2 arduboy;
-	GameState gameState = GameState::Gameplay;
-	Entity player;
-	Camera camera { 0, { 5, 15 } };
-
-	// Temporary sector for the sake of testing
-	Sector dummySector { dummyData };
-
-public:
-	/// To be called from the main ino's setup function
-	void setup()
-	{
-		this->arduboy.begin();
-	}
-
-	/// To be called from the main ino's loop function
-	void loop()
-	{
-		// Don't run unless it's time for the next frame
-		if(!this->arduboy.nextFrame())
-			return;
-
-		// Update the button state
-		this->arduboy.pollButtons();
-
-		// Update the game state
-		this->update();
-
-		// Clear the screen
-		this->arduboy.clear();
-
-		// Render the game
-		this->render();
-
-		// Display the frame buffer
-		this->arduboy.display();
-	}
-
-private:
-	/// Updates the game state
-	void update();
-
-	/// Renders the game state
-	void render();
+#pragma once
+
+#include <Arduboy2.h>
+
+#include "Traits.h"
+#include "Profiler.h"
+#include "GameState.h"
+#include "Entity.h"
+#include "EntityPool.h"
+#include "Camera.h"
+#include "Level.h"
+#include "VertexCache.h"
+#include "SceneTracker.h"
+#include "SectorRendererConfig.h"
+#include "DummyData.h"
+
+class Game
+{
+private:
+	Arduboy2 arduboy;
+	GameState gameState = GameState::Gameplay;
+	Entity player;
+	Camera camera { BinaryAngleU16(0), { 5, 15 } };
+
+	// Temporary level for the sake of testing
+	Level level { dummyLevel };
+
+	// Everything in the level but the player
+	EntityPool<16> entities;
+
+	// The level's points, rotated for the camera's angle, kept between frames.
+	// With a slot for each of them, none is ever rotated twice at the same angle.
+	VertexCache<dummyLevelPointCount> transformCache;
+
+	// What the last frame was drawn from, so that unchanged frames aren't drawn again
+	SceneTracker sceneTracker;
+
+	// How far the eye is above the floor, halfway up a wall
+	static constexpr SQ15x16 eyeHeight()
+	{
+		return 0.5;
+	}
+
+	// The highest step the player can climb
+	static constexpr SQ15x16 maxStepHeight()
+	{
+		return 0.25;
+	}
+
+public:
+	/// To be called from the main ino's setup function
+	void setup()
+	{
+		this->arduboy.begin();
+
+		this->standOnFloor();
+
+		// Temporary entities for the sake of testing
+		this->entities.create({ 12, 12 }, {}, 0);
+		this->entities.create({ 15, 15 }, {}, 0);
+		this->entities.create({ 30, 15 }, {}, 0);
+
+		// The profiler's results are streamed over USB
+		if(profiler::isEnabled())
+			Serial.begin(9600);
+	}
+
+	/// To be called from the main ino's loop function
+	void loop()
+	{
+		// Don't run unless it's time for the next frame
+		if(!this->arduboy.nextFrame())
+			return;
+
+		// Update the button state
+		this->arduboy.pollButtons();
+
+		// Update the game state
+		this->update();
+
+		// An unchanged frame is left in the frame buffer and on the display
+		if(this->isSceneChanged())
+		{
+			// Clear the screen
+			this->clear();
+
+			// Render the game
+			this->render();
+
+			// Display the frame buffer
+			this->display();
+
+			this->sceneTracker.setDrawn(this->camera);
+		}
+
+		this->endFrame();
+	}
+
+private:
+	/// Updates the game state
+	void update();
+
+	/// Checks whether the player can move into a sector from the one they're in
+	bool canEnter(SectorId sector) const;
+
+	/// Puts the camera's eye height above the floor of its sector
+	void standOnFloor();
+
+	/// Checks whether anything has changed since the last frame was drawn
+	bool isSceneChanged();
+
+	/// Renders the game state
+	void render();
+
+	/// Clears the frame buffer
+	void clear();
+
+	/// Sends the frame buffer to the display
+	void display();
+
+	/// Ends the profiler's frame, sending its results over USB when it has new ones
+	void endFrame();
 };
\ No newline at end of file
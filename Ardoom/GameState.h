@@ -1,10 +1,10 @@
-#pragma once
-
-// For uint8_t
-#include <stdint.h>
-
-// Represents a valid game state
-enum class GameState : uint8_t
-{
-	Gameplay,
+#pragma once
+
+// For uint8_t
+#include <stdint.h>
+
+// Represents a valid game state
+enum class GameState : uint8_t
+{
+	Gameplay,
 };
\ No newline at end of file
@@ -1,4 +1,4 @@
-#include "Vector2.h"
-#include "Vector2Aliases.h"
-#include "Point2.h"
+#include "Vector2.h"
+#include "Vector2Aliases.h"
+#include "Point2.h"
 #include "Point2Aliases.h"
\ No newline at end of file
@@ -1,14 +1,18 @@
-#pragma once
-
-#include <stdint.h>
-
-#include "Point2.h"
-
-using Point2F = Point2<float>;
-using Point2D = Point2<double>;
-using Point2LD = Point2<long double>;
-
-using Point2I8 = Point2<int8_t>;
-using Point2I16 = Point2<int16_t>;
-using Point2U8 = Point2<uint8_t>;
+#pragma once
+
+#include <stdint.h>
+
+#include "Point2.h"
+#include "../FixedPoints/FixedPoints.h"
+
+using Point2F = Point2<float>;
+using Point2D = Point2<double>;
+using Point2LD = Point2<long double>;
+
+using Point2SQ7x8 = Point2<SQ7x8>;
+using Point2SQ15x16 = Point2<SQ15x16>;
+
+using Point2I8 = Point2<int8_t>;
+using Point2I16 = Point2<int16_t>;
+using Point2U8 = Point2<uint8_t>;
 using Point2U16 = Point2<uint16_t>;
\ No newline at end of file
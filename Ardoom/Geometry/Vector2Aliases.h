@@ -1,14 +1,18 @@
-#pragma once
-
-#include <stdint.h>
-
-#include "Vector2.h"
-
-using Vector2F = Vector2<float>;
-using Vector2D = Vector2<double>;
-using Vector2LD = Vector2<long double>;
-
-using Vector2I8 = Vector2<int8_t>;
-using Vector2I16 = Vector2<int16_t>;
-using Vector2U8 = Vector2<uint8_t>;
+#pragma once
+
+#include <stdint.h>
+
+#include "Vector2.h"
+#include "../FixedPoints/FixedPoints.h"
+
+using Vector2F = Vector2<float>;
+using Vector2D = Vector2<double>;
+using Vector2LD = Vector2<long double>;
+
+using Vector2SQ7x8 = Vector2<SQ7x8>;
+using Vector2SQ15x16 = Vector2<SQ15x16>;
+
+using Vector2I8 = Vector2<int8_t>;
+using Vector2I16 = Vector2<int16_t>;
+using Vector2U8 = Vector2<uint8_t>;
 using Vector2U16 = Vector2<uint16_t>;
\ No newline at end of file
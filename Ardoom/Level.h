@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "Geometry.h"
+#include "CommonTypes.h"
+#include "LevelFormat.h"
+#include "Sector.h"
+#include "Bsp.h"
+
+// A level in the compiled level format (see LevelFormat.h), in PROGMEM.
+// Sectors are indexed by SectorId.
+class Level
+{
+private:
+	const uint8_t * data;
+	uint8_t sectorCount;
+
+public:
+	/// Levels with the wrong magic or version are treated as having no sectors.
+	Level(const uint8_t * data) :
+		data { data }, sectorCount { static_cast<uint8_t>(isValid(data) ? pgm_read_byte(&data[levelformat::level::sectorCount]) : 0) }
+	{
+	}
+
+	/// Checks that level data is in the format that this version of the game reads.
+	static bool isValid(const uint8_t * data)
+	{
+		return
+		(
+			(pgm_read_byte(&data[levelformat::level::magic + 0]) == levelformat::magic0) &&
+			(pgm_read_byte(&data[levelformat::level::magic + 1]) == levelformat::magic1) &&
+			(pgm_read_byte(&data[levelformat::level::version]) == levelformat::version)
+		);
+	}
+
+	constexpr uint8_t getSectorCount() const
+	{
+		return this->sectorCount;
+	}
+
+	Sector getSector(SectorId sector) const
+	{
+		const uint16_t offset = pgm_read_word(&this->data[levelformat::level::sectorOffsets + (sector * sizeof(uint16_t))]);
+
+		return { &this->data[offset] };
+	}
+
+	/// Gets the level's BSP tree, which is empty if the level doesn't have one.
+	Bsp getBsp() const
+	{
+		const uint16_t offset = (this->sectorCount > 0) ? pgm_read_word(&this->data[levelformat::level::bspOffset]) : 0;
+
+		return { (offset != 0) ? &this->data[offset] : nullptr };
+	}
+
+	/// Finds the sector that contains the given point, or noSector if there isn't one.
+	/// The hint is checked first, since the point usually hasn't left it.
+	SectorId findSector(const Point2SQ15x16 & point, SectorId hint) const
+	{
+		if((hint < this->sectorCount) && this->getSector(hint).contains(point))
+			return hint;
+
+		for(SectorId sector = 0; sector < this->sectorCount; ++sector)
+			if((sector != hint) && this->getSector(sector).contains(point))
+				return sector;
+
+		return noSector;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "FixedPoints.h"
+
+// The binary level format written by the level compiler (Host/LevelCompiler.cpp).
+// Everything static about the geometry is worked out offline,
+// so the game only ever reads it.
+//
+// Multi-byte values are little endian.
+// SQ15x16 and SQ7x8 values are stored as their internal representation.
+//
+// Level
+//   uint8_t magic[2]         'A', 'L'
+//   uint8_t version
+//   uint8_t sectorCount
+//   uint16_t bspOffset, from the start of the level, or 0 if there is no BSP tree
+//   uint16_t sectorOffsets[sectorCount], from the start of the level
+//
+// Sector
+//   uint8_t pointCount
+//   SQ15x16 minimumX, minimumY, maximumX, maximumY
+//   SQ7x8 floorHeight, ceilingHeight
+//   uint8_t light            the brightness of surfaces at a depth of 1, out of dither::levelCount
+//   uint16_t firstPoint      the PointId of the sector's first point, the sum of the point counts of the sectors before it
+//   Edge edges[pointCount]
+//
+// Edge, from its point to the next point of the sector
+//   SQ15x16 x, y             the point
+//   SQ15x16 normalX, normalY unit normal, pointing into the sector
+//   SQ15x16 length
+//   SQ7x8 textureScale       multiplies the distance along the edge for texturing
+//   uint8_t neighbour        the sector across the edge, or noSector
+//
+// Sectors are convex with their points wound anticlockwise.
+// Heights are in the same units as positions, a floor below its ceiling.
+//
+// BSP tree
+//   uint16_t root            the node or leaf to start from
+//   uint16_t nodeCount
+//   uint16_t leafCount
+//   uint16_t segmentCount
+//   Node nodes[nodeCount]
+//   Leaf leaves[leafCount]
+//   Segment segments[segmentCount]
+//
+// Node
+//   SQ15x16 normalX, normalY, distance
+//                            points where dot(point, normal) >= distance are in front
+//   uint8_t frontBox[4]      minimumX, minimumY, maximumX, maximumY of everything in front,
+//   uint8_t backBox[4]       and of everything behind, rounded outwards
+//   uint16_t front, back     children: node indices, or leaf indices with leafFlag set
+//
+// Leaf, a set of segments that can't hide each other
+//   uint16_t firstSegment
+//   uint8_t segmentCount
+//
+// Segment, all or part of an edge, facing the same way
+//   SQ15x16 startX, startY, endX, endY
+//   SQ15x16 startU, endU     the distance along the edge at each end, multiplied by its texture scale
+//   uint8_t sector           the sector that the edge belongs to
+//   uint8_t neighbour        the sector across the edge, or noSector
+//   uint8_t flags            segment::startsAfterWall, segment::endsBeforePortal
+//   uint8_t edge             the index of the edge within its sector, whose normal gives the side the segment is seen from
+namespace levelformat
+{
+	constexpr uint8_t magic0 = 'A';
+	constexpr uint8_t magic1 = 'L';
+	constexpr uint8_t version = 6;
+
+	namespace level
+	{
+		constexpr uint8_t magic = 0;
+		constexpr uint8_t version = 2;
+		constexpr uint8_t sectorCount = 3;
+		constexpr uint8_t bspOffset = 4;
+		constexpr uint8_t sectorOffsets = 6;
+	}
+
+	namespace sector
+	{
+		constexpr uint8_t pointCount = 0;
+		constexpr uint8_t minimumX = 1;
+		constexpr uint8_t minimumY = 5;
+		constexpr uint8_t maximumX = 9;
+		constexpr uint8_t maximumY = 13;
+		constexpr uint8_t floorHeight = 17;
+		constexpr uint8_t ceilingHeight = 19;
+		constexpr uint8_t light = 21;
+		constexpr uint8_t firstPoint = 22;
+		constexpr uint8_t edges = 24;
+	}
+
+	namespace edge
+	{
+		constexpr uint8_t x = 0;
+		constexpr uint8_t y = 4;
+		constexpr uint8_t normalX = 8;
+		constexpr uint8_t normalY = 12;
+		constexpr uint8_t length = 16;
+		constexpr uint8_t textureScale = 20;
+		constexpr uint8_t neighbour = 22;
+
+		constexpr uint8_t size = 23;
+	}
+
+	namespace bsp
+	{
+		constexpr uint8_t root = 0;
+		constexpr uint8_t nodeCount = 2;
+		constexpr uint8_t leafCount = 4;
+		constexpr uint8_t segmentCount = 6;
+		constexpr uint8_t nodes = 8;
+
+		constexpr uint16_t leafFlag = 0x8000;
+	}
+
+	namespace node
+	{
+		constexpr uint8_t normalX = 0;
+		constexpr uint8_t normalY = 4;
+		constexpr uint8_t distance = 8;
+		constexpr uint8_t frontBox = 12;
+		constexpr uint8_t backBox = 16;
+		constexpr uint8_t front = 20;
+		constexpr uint8_t back = 22;
+
+		constexpr uint8_t size = 24;
+	}
+
+	namespace leaf
+	{
+		constexpr uint8_t firstSegment = 0;
+		constexpr uint8_t segmentCount = 2;
+
+		constexpr uint8_t size = 3;
+	}
+
+	namespace segment
+	{
+		constexpr uint8_t startX = 0;
+		constexpr uint8_t startY = 4;
+		constexpr uint8_t endX = 8;
+		constexpr uint8_t endY = 12;
+		constexpr uint8_t startU = 16;
+		constexpr uint8_t endU = 20;
+		constexpr uint8_t sector = 24;
+		constexpr uint8_t neighbour = 25;
+		constexpr uint8_t flags = 26;
+		constexpr uint8_t edge = 27;
+
+		constexpr uint8_t size = 28;
+
+		// The segment starts at the start of its edge, and the previous edge is a wall,
+		// so its left end is a corner that it outlines.
+		// (Corners after a portal are outlined by the wall on the other side.)
+		constexpr uint8_t startsAfterWall = (1 << 0);
+
+		// The segment ends at the end of its edge, and the next edge is a portal,
+		// so its right end is a corner that the next edge won't outline
+		constexpr uint8_t endsBeforePortal = (1 << 1);
+	}
+
+	/// Reads an SQ15x16 from PROGMEM.
+	inline SQ15x16 readSQ15x16(const uint8_t * address)
+	{
+		return SQ15x16::fromInternal(static_cast<int32_t>(pgm_read_dword(address)));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "FrameBuffer.h"
+
+// Line policies decide how SectorRenderer's lines reach the screen.
+// Lines are always drawn in white.
+
+/// Draws lines with the renderer's own line functions.
+struct RendererLinePolicy
+{
+	template<typename Renderer>
+	void drawLine(Renderer & renderer, int16_t x0, int16_t y0, int16_t x1, int16_t y1) const
+	{
+		renderer.drawLine(x0, y0, x1, y1);
+	}
+
+	/// Draws the rows of a column from top (inclusive) to bottom (exclusive), which must be on screen.
+	template<typename Renderer>
+	void drawVerticalLine(Renderer & renderer, uint8_t x, uint8_t top, uint8_t bottom) const
+	{
+		renderer.drawFastVLine(x, top, (bottom - top));
+	}
+};
+
+/// Draws lines straight into the renderer's frame buffer, a byte at a time rather than a pixel at a time.
+/// Works with any renderer that exposes its buffer in the SSD1306 page layout.
+struct FrameBufferLinePolicy
+{
+	template<typename Renderer>
+	void drawLine(Renderer & renderer, int16_t x0, int16_t y0, int16_t x1, int16_t y1) const
+	{
+		framebuffer::drawLine<Renderer::width(), Renderer::height()>(renderer.getBuffer(), x0, y0, x1, y1);
+	}
+
+	/// Draws the rows of a column from top (inclusive) to bottom (exclusive), which must be on screen.
+	template<typename Renderer>
+	void drawVerticalLine(Renderer & renderer, uint8_t x, uint8_t top, uint8_t bottom) const
+	{
+		framebuffer::fillColumn<Renderer::width()>(renderer.getBuffer(), x, top, bottom, 0xFF);
+	}
+};
@@ -1,87 +1,175 @@
-#pragma once
-
-// Include intmax_t
-#include <stdint.h>
-
-#if defined(abs)
-#undef abs
-#endif
-
-namespace maths
-{
-	//
-	// abs
-	//
-
-	constexpr int abs(int value)
-	{
-		return (value < 0) ? -value : value;
-	}
-
-	constexpr long abs(long value)
-	{
-		return (value < 0) ? -value : value;
-	}
-
-	constexpr long long abs(long long value)
-	{
-		return (value < 0) ? -value : value;
-	}
-
-	//
-	// lerp
-	//
-
-	constexpr float lerp(float low, float high, float factor)
-	{
-		return (((1 - factor) * low) + (factor * high));
-	}
-
-	constexpr double lerp(double low, double high, double factor)
-	{
-		return (((1 - factor) * low) + (factor * high));
-	}
-
-	constexpr long double lerp(long double low, long double high, long double factor)
-	{
-		return (((1 - factor) * low) + (factor * high));
-	}
-
-	//
-	// inverseLerp
-	//
-
-	constexpr float inverseLerp(float first, float second, float factor) noexcept
-	{
-		return ((factor - first) / (second - first));
-	}
-
-	constexpr double inverseLerp(double first, double second, double factor) noexcept
-	{
-		return ((factor - first) / (second - first));
-	}
-
-	constexpr long double inverseLerp(long double first, long double second, long double factor) noexcept
-	{
-		return ((factor - first) / (second - first));
-	}
-
-	//
-	// map
-	//
-
-	constexpr float map(float from, float fromLow, float fromHigh, float toLow, float toHigh) noexcept
-	{
-		return (toLow + (from - fromLow) * ((toHigh - toLow) / (fromHigh - fromLow)));
-	}
-
-	constexpr double map(double from, double fromLow, double fromHigh, double toLow, double toHigh) noexcept
-	{
-		return (toLow + (from - fromLow) * ((toHigh - toLow) / (fromHigh - fromLow)));
-	}
-
-	constexpr long double map(long double from, long double fromLow, long double fromHigh, long double toLow, long double toHigh) noexcept
-	{
-		return (toLow + (from - fromLow) * ((toHigh - toLow) / (fromHigh - fromLow)));
-	}
+#pragma once
+
+// Include intmax_t
+#include <stdint.h>
+
+// For SFixed
+#include "FixedPoints.h"
+
+#if defined(abs)
+#undef abs
+#endif
+
+namespace maths
+{
+	//
+	// abs
+	//
+
+	constexpr int abs(int value)
+	{
+		return (value < 0) ? -value : value;
+	}
+
+	constexpr long abs(long value)
+	{
+		return (value < 0) ? -value : value;
+	}
+
+	constexpr long long abs(long long value)
+	{
+		return (value < 0) ? -value : value;
+	}
+
+	template<unsigned IntegerSize, unsigned FractionSize>
+	constexpr SFixed<IntegerSize, FractionSize> abs(SFixed<IntegerSize, FractionSize> value)
+	{
+		return (value < 0) ? -value : value;
+	}
+
+	//
+	// lerp
+	//
+
+	constexpr float lerp(float low, float high, float factor)
+	{
+		return (((1 - factor) * low) + (factor * high));
+	}
+
+	constexpr double lerp(double low, double high, double factor)
+	{
+		return (((1 - factor) * low) + (factor * high));
+	}
+
+	constexpr long double lerp(long double low, long double high, long double factor)
+	{
+		return (((1 - factor) * low) + (factor * high));
+	}
+
+	// Uses a single multiplication instead of two
+	template<unsigned IntegerSize, unsigned FractionSize>
+	constexpr SFixed<IntegerSize, FractionSize> lerp(SFixed<IntegerSize, FractionSize> low, SFixed<IntegerSize, FractionSize> high, SFixed<IntegerSize, FractionSize> factor)
+	{
+		return (low + ((high - low) * factor));
+	}
+
+	//
+	// inverseLerp
+	//
+
+	constexpr float inverseLerp(float first, float second, float factor) noexcept
+	{
+		return ((factor - first) / (second - first));
+	}
+
+	constexpr double inverseLerp(double first, double second, double factor) noexcept
+	{
+		return ((factor - first) / (second - first));
+	}
+
+	constexpr long double inverseLerp(long double first, long double second, long double factor) noexcept
+	{
+		return ((factor - first) / (second - first));
+	}
+
+	template<unsigned IntegerSize, unsigned FractionSize>
+	constexpr SFixed<IntegerSize, FractionSize> inverseLerp(SFixed<IntegerSize, FractionSize> first, SFixed<IntegerSize, FractionSize> second, SFixed<IntegerSize, FractionSize> factor) noexcept
+	{
+		return ((factor - first) / (second - first));
+	}
+
+	//
+	// reciprocal
+	//
+
+	/// Calculates (1 / value) without dividing.
+	/// The value is normalised to [0.5, 1) and a linear estimate of its reciprocal
+	/// is refined by two Newton-Raphson steps, all in 16x16 bit multiplies.
+	/// The result has about 14 significant bits. Results too large to represent saturate.
+	inline SQ15x16 reciprocal(SQ15x16 value)
+	{
+		constexpr int32_t maximum = 0x7FFFFFFF;
+
+		const bool negative = (value < 0);
+		uint32_t normalised = static_cast<uint32_t>(negative ? -value.getInternal() : value.getInternal());
+
+		if(normalised == 0)
+			return SQ15x16::fromInternal(maximum);
+
+		uint8_t shift = 0;
+
+		while((normalised & 0xFF000000) == 0)
+		{
+			normalised <<= 8;
+			shift += 8;
+		}
+
+		while((normalised & 0x80000000) == 0)
+		{
+			normalised <<= 1;
+			++shift;
+		}
+
+		// [0.5, 1) as Q0.16
+		const uint16_t mantissa = static_cast<uint16_t>(normalised >> 16);
+
+		// (48 / 17) - ((32 / 17) * mantissa) as Q2.14
+		uint16_t estimate = static_cast<uint16_t>(46261u - ((30840ul * mantissa) >> 16));
+
+		for(uint8_t step = 0; step < 2; ++step)
+		{
+			// 2 - (mantissa * estimate) as Q2.30
+			const uint32_t error = (0x80000000ul - (static_cast<uint32_t>(mantissa) * estimate));
+			estimate = static_cast<uint16_t>((static_cast<uint32_t>(estimate) * (error >> 16)) >> 14);
+		}
+
+		// The estimate is (1 / mantissa) as Q2.14 and the result is (1 / mantissa) scaled by 2 to the power of shift
+		if(shift >= 30)
+			return SQ15x16::fromInternal(negative ? -maximum : maximum);
+
+		const int32_t result = (shift >= 14) ? static_cast<int32_t>(static_cast<uint32_t>(estimate) << (shift - 14)) : static_cast<int32_t>(estimate >> (14 - shift));
+
+		return SQ15x16::fromInternal(negative ? -result : result);
+	}
+
+	//
+	// map
+	//
+
+	constexpr float map(float from, float fromLow, float fromHigh, float toLow, float toHigh) noexcept
+	{
+		return (toLow + (from - fromLow) * ((toHigh - toLow) / (fromHigh - fromLow)));
+	}
+
+	constexpr double map(double from, double fromLow, double fromHigh, double toLow, double toHigh) noexcept
+	{
+		return (toLow + (from - fromLow) * ((toHigh - toLow) / (fromHigh - fromLow)));
+	}
+
+	constexpr long double map(long double from, long double fromLow, long double fromHigh, long double toLow, long double toHigh) noexcept
+	{
+		return (toLow + (from - fromLow) * ((toHigh - toLow) / (fromHigh - fromLow)));
+	}
+
+	// Multiplies before dividing to preserve precision,
+	// in the wider intermediate type so that the product can't overflow
+	template<unsigned IntegerSize, unsigned FractionSize>
+	constexpr SFixed<IntegerSize, FractionSize> map(SFixed<IntegerSize, FractionSize> from, SFixed<IntegerSize, FractionSize> fromLow, SFixed<IntegerSize, FractionSize> fromHigh, SFixed<IntegerSize, FractionSize> toLow, SFixed<IntegerSize, FractionSize> toHigh) noexcept
+	{
+		using Fixed = SFixed<IntegerSize, FractionSize>;
+		using InternalType = typename Fixed::InternalType;
+		using IntermediateType = typename Fixed::IntermediateType;
+
+		return (toLow + Fixed::fromInternal(static_cast<InternalType>((static_cast<IntermediateType>((from - fromLow).getInternal()) * (toHigh - toLow).getInternal()) / (fromHigh - fromLow).getInternal())));
+	}
 }
\ No newline at end of file
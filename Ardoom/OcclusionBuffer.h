@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stdint.h>
+
+/// Tracks which rows of each screen column are still visible.
+/// A column's visible rows run from its top (inclusive) to its bottom (exclusive).
+/// Closed columns are also recorded in a bitmask, so that runs of them can be
+/// skipped eight at a time and rendering can stop as soon as every column is closed.
+template<uint8_t Width>
+class OcclusionBuffer
+{
+private:
+	uint8_t top[Width];
+	uint8_t bottom[Width];
+	uint8_t closed[(Width + 7) / 8];
+	uint8_t openCount;
+
+public:
+	/// Opens every column fully.
+	void reset(uint8_t height)
+	{
+		for(uint8_t x = 0; x < Width; ++x)
+		{
+			this->top[x] = 0;
+			this->bottom[x] = height;
+		}
+
+		for(uint8_t index = 0; index < sizeof(this->closed); ++index)
+			this->closed[index] = 0;
+
+		this->openCount = Width;
+	}
+
+	uint8_t getTop(uint8_t x) const
+	{
+		return this->top[x];
+	}
+
+	uint8_t getBottom(uint8_t x) const
+	{
+		return this->bottom[x];
+	}
+
+	bool isOpen(uint8_t x) const
+	{
+		return ((this->closed[x / 8] & (1 << (x % 8))) == 0);
+	}
+
+	/// Checks if every column has been closed.
+	bool isComplete() const
+	{
+		return (this->openCount == 0);
+	}
+
+	/// Checks if any column from left (inclusive) to right (exclusive) is still open.
+	bool isAnyOpen(uint8_t left, uint8_t right) const
+	{
+		uint8_t x = left;
+
+		// Leading columns up to a byte boundary
+		for(; ((x % 8) != 0) && (x < right); ++x)
+			if(this->isOpen(x))
+				return true;
+
+		// Whole bytes
+		for(; (x + 8) <= right; x += 8)
+			if(this->closed[x / 8] != 0xFF)
+				return true;
+
+		// Trailing columns
+		for(; x < right; ++x)
+			if(this->isOpen(x))
+				return true;
+
+		return false;
+	}
+
+	/// Closes a column so that nothing more is drawn in it.
+	void close(uint8_t x)
+	{
+		if(!this->isOpen(x))
+			return;
+
+		this->closed[x / 8] |= (1 << (x % 8));
+		this->top[x] = this->bottom[x];
+		--this->openCount;
+	}
+
+	/// Narrows a column to the rows from top (inclusive) to bottom (exclusive),
+	/// closing it if nothing remains visible.
+	void narrow(uint8_t x, int16_t top, int16_t bottom)
+	{
+		if(top > this->top[x])
+			this->top[x] = (top < this->bottom[x]) ? static_cast<uint8_t>(top) : this->bottom[x];
+
+		if(bottom < this->bottom[x])
+			this->bottom[x] = (bottom > this->top[x]) ? static_cast<uint8_t>(bottom) : this->top[x];
+
+		if(this->top[x] >= this->bottom[x])
+			this->close(x);
+	}
+};
\ No newline at end of file
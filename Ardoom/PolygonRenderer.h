@@ -1,16 +1,207 @@
-#pragma once
-
-#include "Constants.h"
-#include "Geometry.h"
-#include "Maths.h"
-#include "Texture.h"
-#include "Quad.h"
-
-template<typename Renderer>
-struct TextureRenderer
-{
-	static void drawQuad(Renderer & renderer, const Texture & texture, const Quad & quad)
-	{
-		
-	}
+#pragma once
+
+#include "Constants.h"
+#include "Geometry.h"
+#include "Maths.h"
+#include "Texture.h"
+#include "Quad.h"
+#include "Profiler.h"
+
+template<typename Renderer>
+struct TextureRenderer
+{
+	/// Draws a quad whose left and right edges are vertical,
+	/// such as a wall seen from the front.
+	/// The points go clockwise from the top left.
+	/// The texture is mapped affinely, as the quad carries no depth.
+	template<typename TextureType>
+	static void drawQuad(Renderer & renderer, const TextureType & texture, const Quad & quad)
+	{
+		const Point2SQ15x16 & topLeft = quad.points[0];
+		const Point2SQ15x16 & topRight = quad.points[1];
+		const Point2SQ15x16 & bottomRight = quad.points[2];
+		const Point2SQ15x16 & bottomLeft = quad.points[3];
+
+		if(topLeft.x >= topRight.x)
+			return;
+
+		const SQ15x16 screenWidth = renderer.width();
+
+		if((topRight.x <= 0) || (topLeft.x >= screenWidth))
+			return;
+
+		const SQ15x16 inverseWidth = maths::reciprocal(topRight.x - topLeft.x);
+
+		// The edges and the texture column change linearly across the quad
+		const SQ15x16 topStep = ((topRight.y - topLeft.y) * inverseWidth);
+		const SQ15x16 bottomStep = ((bottomRight.y - bottomLeft.y) * inverseWidth);
+		const SQ15x16 textureStep = (SQ15x16(texture.getWidth()) * inverseWidth);
+
+		const uint8_t startColumn = (topLeft.x > 0) ? getColumn(topLeft.x) : 0;
+		const uint8_t endColumn = (topRight.x < screenWidth) ? getColumn(topRight.x) : renderer.width();
+
+		const SQ15x16 offset = (SQ15x16(startColumn) - topLeft.x);
+
+		SQ15x16 top = (topLeft.y + (offset * topStep));
+		SQ15x16 bottom = (bottomLeft.y + (offset * bottomStep));
+		SQ15x16 textureX = (offset * textureStep);
+
+		const uint8_t lastTextureColumn = (texture.getWidth() - 1);
+
+		for(uint8_t x = startColumn; x < endColumn; ++x, top += topStep, bottom += bottomStep, textureX += textureStep)
+		{
+			if(bottom <= top)
+				continue;
+
+			const uint8_t clipTop = getRow(renderer, top);
+			const uint8_t clipBottom = getRow(renderer, bottom);
+
+			const uint8_t column = (textureX < lastTextureColumn) ? static_cast<uint8_t>(textureX) : lastTextureColumn;
+			const SQ15x16 step = (SQ15x16(texture.getHeight()) * maths::reciprocal(bottom - top));
+
+			drawColumn(renderer, texture, x, column, top, step, clipTop, clipBottom);
+		}
+	}
+
+	/// Draws one column of a texture, stretched to fit the screen.
+	/// 'top' is the screen position of the texture's top edge,
+	/// and 'step' is the number of texels from one row to the next.
+	/// Only the rows from clipTop (inclusive) to clipBottom (exclusive) are drawn,
+	/// and rows beyond the texture's edges are left blank.
+	/// Each page of the frame buffer is written once,
+	/// and when texels and rows are the same size whole bytes of the texture are copied.
+	template<typename TextureType>
+	static void drawColumn(Renderer & renderer, const TextureType & texture, uint8_t x, uint8_t textureX, SQ15x16 top, SQ15x16 step, uint8_t clipTop, uint8_t clipBottom)
+	{
+		if(clipTop >= clipBottom)
+			return;
+
+		profiler::count(profiler::Counter::PixelsWritten, (clipBottom - clipTop));
+
+		uint8_t * pointer = &renderer.getBuffer()[((clipTop / 8) * Renderer::width()) + x];
+
+		const SQ15x16 firstTexel = ((SQ15x16(clipTop) - top) * step);
+
+		if(isUnitStep(step))
+		{
+			// Rows map to texels one to one, so each page is 8 consecutive texels
+			const int16_t firstRow = static_cast<int16_t>(firstTexel + SQ15x16(0.5));
+
+			for(uint8_t y = clipTop; y < clipBottom;)
+			{
+				const uint8_t pageTop = (y & ~7);
+				const uint8_t pageEnd = ((clipBottom - pageTop) < 8) ? clipBottom : (pageTop + 8);
+
+				const uint8_t texels = readTexels(texture, textureX, (firstRow + (pageTop - clipTop)));
+
+				writeMasked(pointer, getRowMask(y, pageEnd), texels);
+
+				pointer += Renderer::width();
+				y = pageEnd;
+			}
+
+			return;
+		}
+
+		const SQ15x16 textureHeight = texture.getHeight();
+
+		// The texture byte is only read again when the texel moves to another page
+		uint8_t texturePage = 0xFF;
+		uint8_t textureByte = 0;
+
+		SQ15x16 texel = firstTexel;
+
+		for(uint8_t y = clipTop; y < clipBottom;)
+		{
+			const uint8_t pageTop = (y & ~7);
+			const uint8_t pageEnd = ((clipBottom - pageTop) < 8) ? clipBottom : (pageTop + 8);
+
+			uint8_t texels = 0;
+
+			for(uint8_t row = y; row < pageEnd; ++row, texel += step)
+			{
+				// Rows beyond the texture are left blank, as they are when rows and texels are the same size
+				if((texel < 0) || (texel >= textureHeight))
+					continue;
+
+				const uint8_t index = static_cast<uint8_t>(texel);
+				const uint8_t page = (index / 8);
+
+				if(page != texturePage)
+				{
+					texturePage = page;
+					textureByte = texture.getByte(textureX, page);
+				}
+
+				if((textureByte & (1 << (index % 8))) != 0)
+					texels |= (1 << (row % 8));
+			}
+
+			writeMasked(pointer, getRowMask(y, pageEnd), texels);
+
+			pointer += Renderer::width();
+			y = pageEnd;
+		}
+	}
+
+private:
+	// Close enough to one that a full screen column drifts by less than half a row
+	static bool isUnitStep(SQ15x16 step)
+	{
+		return (maths::abs(step - 1) < SQ15x16(1.0 / (2 * 64)));
+	}
+
+	// Gets the 8 texels of a column starting from a row, which may lie outside the texture
+	template<typename TextureType>
+	static uint8_t readTexels(const TextureType & texture, uint8_t x, int16_t row)
+	{
+		if(row <= -8)
+			return 0;
+
+		if(row < 0)
+			return static_cast<uint8_t>(texture.getByte(x, 0) << -row);
+
+		const uint8_t pageCount = ((texture.getHeight() + 7) / 8);
+		const uint8_t page = static_cast<uint8_t>(row / 8);
+		const uint8_t shift = static_cast<uint8_t>(row % 8);
+
+		if(page >= pageCount)
+			return 0;
+
+		uint8_t result = (texture.getByte(x, page) >> shift);
+
+		if((shift != 0) && ((page + 1) < pageCount))
+			result |= static_cast<uint8_t>(texture.getByte(x, (page + 1)) << (8 - shift));
+
+		return result;
+	}
+
+	// Gets the bits of a page for the rows from 'from' to 'to' (exclusive), both within the same page
+	static uint8_t getRowMask(uint8_t from, uint8_t to)
+	{
+		return static_cast<uint8_t>((0xFF << (from % 8)) & (0xFF >> (7 - ((to - 1) % 8))));
+	}
+
+	static void writeMasked(uint8_t * pointer, uint8_t mask, uint8_t bits)
+	{
+		*pointer = ((*pointer & ~mask) | (bits & mask));
+	}
+
+	// Gets the first column at or after a screen position
+	static uint8_t getColumn(SQ15x16 x)
+	{
+		return static_cast<uint8_t>((x.getInternal() + (SQ15x16::scale - 1)) >> SQ15x16::fractionSize);
+	}
+
+	// Gets the first row at or after a screen position within the screen
+	static uint8_t getRow(Renderer & renderer, SQ15x16 y)
+	{
+		if(y <= 0)
+			return 0;
+
+		if(y >= renderer.height())
+			return renderer.height();
+
+		return static_cast<uint8_t>((y.getInternal() + (SQ15x16::scale - 1)) >> SQ15x16::fractionSize);
+	}
 };
\ No newline at end of file
@@ -0,0 +1,286 @@
+#pragma once
+
+// For uint8_t, uint32_t
+#include <stdint.h>
+
+// For micros
+#include <Arduino.h>
+
+// For PROGMEM, pgm_read_byte
+#include <avr/pgmspace.h>
+
+// Times the stages of each frame and counts the work they do,
+// keeping the minimum, average and maximum of each over a window of frames.
+//
+// The profiler is only built in when ARDOOM_PROFILE is defined (for example with -DARDOOM_PROFILE).
+// Otherwise every timer and counter is an empty inline function,
+// so instrumented code compiles to exactly what it would be without them.
+//
+// Times are in microseconds, measured with micros(),
+// which steps every 4 microseconds on the Arduboy and uses steady_clock on the host.
+// Timing a stage costs two calls to micros(), which is included in the stage's time,
+// so stages timed many times a frame (Transform, Projection) read a little high.
+namespace profiler
+{
+	/// The parts of a frame that are timed.
+	/// Transform, Projection and Rasterisation happen during rendering, interleaved,
+	/// so each is the total of every time it ran during the frame.
+	enum class Stage : uint8_t
+	{
+		Update,
+		Clear,
+		Transform,
+		Projection,
+		Rasterisation,
+		Display,
+	};
+
+	constexpr uint8_t stageCount = 6;
+
+	/// The amounts of work counted each frame.
+	enum class Counter : uint8_t
+	{
+		// Walls rejected before being projected
+		WallsCulled,
+
+		// Solid walls that drew at least one column
+		WallsDrawn,
+
+		// Pixels covered by the rasterisers, whether or not they were already set
+		PixelsWritten,
+	};
+
+	constexpr uint8_t counterCount = 3;
+
+	/// The number of frames that each set of results covers.
+	constexpr uint8_t windowSize = 32;
+
+	constexpr bool isEnabled()
+	{
+#if defined(ARDOOM_PROFILE)
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	/// The spread of a time or count over a window of frames.
+	struct Summary
+	{
+		uint32_t minimum;
+		uint32_t average;
+		uint32_t maximum;
+	};
+
+	namespace detail
+	{
+		// A time or count for the current frame, and how it has varied over the window so far
+		struct Entry
+		{
+			uint32_t current;
+			uint32_t minimum;
+			uint32_t maximum;
+			uint32_t total;
+		};
+
+		struct Profile
+		{
+			Entry stages[stageCount];
+			Entry counters[counterCount];
+
+			// The results of the last complete window
+			Summary stageResults[stageCount];
+			Summary counterResults[counterCount];
+
+			// How many frames of the current window have ended
+			uint8_t frame;
+		};
+
+		// Only reached when the profiler is built in,
+		// so otherwise it is optimised away along with the profile
+		inline Profile & getProfile()
+		{
+			static Profile profile;
+			return profile;
+		}
+
+		// Four letter names, for the rows of the table
+		const char entryNames[stageCount + counterCount][4] PROGMEM
+		{
+			{ 'U', 'p', 'd', 't' },
+			{ 'C', 'l', 'r', ' ' },
+			{ 'X', 'f', 'r', 'm' },
+			{ 'P', 'r', 'o', 'j' },
+			{ 'R', 'a', 's', 't' },
+			{ 'D', 'i', 's', 'p' },
+			{ 'C', 'u', 'l', 'l' },
+			{ 'W', 'a', 'l', 'l' },
+			{ 'P', 'i', 'x', ' ' },
+		};
+
+		inline void endEntry(Entry & entry, bool isFirst)
+		{
+			entry.minimum = (isFirst || (entry.current < entry.minimum)) ? entry.current : entry.minimum;
+			entry.maximum = (isFirst || (entry.current > entry.maximum)) ? entry.current : entry.maximum;
+			entry.total = (isFirst ? 0 : entry.total) + entry.current;
+			entry.current = 0;
+		}
+
+		inline Summary summarise(const Entry & entry)
+		{
+			return { entry.minimum, (entry.total / windowSize), entry.maximum };
+		}
+
+		template<typename Printer>
+		void printName(Printer & printer, uint8_t index)
+		{
+			for(uint8_t character = 0; character < 4; ++character)
+				printer.print(static_cast<char>(pgm_read_byte(&entryNames[index][character])));
+		}
+
+		// Right aligns a value in a field of 'width' characters, as long as it fits
+		template<typename Printer>
+		void printPadded(Printer & printer, uint32_t value, uint8_t width)
+		{
+			uint8_t digits = 1;
+
+			for(uint32_t remaining = (value / 10); remaining > 0; remaining /= 10)
+				++digits;
+
+			for(; digits < width; ++digits)
+				printer.print(' ');
+
+			printer.print(static_cast<unsigned long>(value));
+		}
+
+		template<typename Printer>
+		void printRow(Printer & printer, uint8_t index, const Summary & summary, uint8_t width)
+		{
+			printName(printer, index);
+			printPadded(printer, summary.minimum, width);
+			printPadded(printer, summary.average, width);
+			printPadded(printer, summary.maximum, width);
+			printer.print('\n');
+		}
+	}
+
+	/// Adds the time a stage took to the current frame.
+	inline void addTime(Stage stage, uint32_t microseconds)
+	{
+		if(isEnabled())
+			detail::getProfile().stages[static_cast<uint8_t>(stage)].current += microseconds;
+	}
+
+	/// Adds to a count for the current frame.
+	inline void count(Counter counter, uint32_t amount = 1)
+	{
+		if(isEnabled())
+			detail::getProfile().counters[static_cast<uint8_t>(counter)].current += amount;
+	}
+
+	/// Ends the current frame.
+	/// Returns true if it completed a window, updating the results.
+	inline bool endFrame()
+	{
+		if(!isEnabled())
+			return false;
+
+		detail::Profile & profile = detail::getProfile();
+
+		const bool isFirst = (profile.frame == 0);
+
+		for(detail::Entry & entry : profile.stages)
+			detail::endEntry(entry, isFirst);
+
+		for(detail::Entry & entry : profile.counters)
+			detail::endEntry(entry, isFirst);
+
+		++profile.frame;
+
+		if(profile.frame < windowSize)
+			return false;
+
+		profile.frame = 0;
+
+		for(uint8_t index = 0; index < stageCount; ++index)
+			profile.stageResults[index] = detail::summarise(profile.stages[index]);
+
+		for(uint8_t index = 0; index < counterCount; ++index)
+			profile.counterResults[index] = detail::summarise(profile.counters[index]);
+
+		return true;
+	}
+
+	/// Gets the results of the last complete window for a stage, in microseconds.
+	inline Summary getResults(Stage stage)
+	{
+		return isEnabled() ? detail::getProfile().stageResults[static_cast<uint8_t>(stage)] : Summary {};
+	}
+
+	/// Gets the results of the last complete window for a counter.
+	inline Summary getResults(Counter counter)
+	{
+		return isEnabled() ? detail::getProfile().counterResults[static_cast<uint8_t>(counter)] : Summary {};
+	}
+
+	/// Prints the results of the last complete window as a table,
+	/// one row per stage then one per counter, giving the minimum, average and maximum.
+	/// Works with anything that prints like Arduino's Print, such as Serial or Arduboy2.
+	template<typename Printer>
+	void printTable(Printer & printer)
+	{
+		if(!isEnabled())
+			return;
+
+		const detail::Profile & profile = detail::getProfile();
+
+		printer.print("         min     avg     max\n");
+
+		for(uint8_t index = 0; index < stageCount; ++index)
+			detail::printRow(printer, index, profile.stageResults[index], 8);
+
+		for(uint8_t index = 0; index < counterCount; ++index)
+			detail::printRow(printer, (stageCount + index), profile.counterResults[index], 8);
+	}
+
+	/// Prints the results of the last complete window within the screen's 21 by 8 characters:
+	/// a row per stage as in printTable, then the average of each counter on one row.
+	template<typename Printer>
+	void printOverlay(Printer & printer)
+	{
+		if(!isEnabled())
+			return;
+
+		const detail::Profile & profile = detail::getProfile();
+
+		for(uint8_t index = 0; index < stageCount; ++index)
+			detail::printRow(printer, index, profile.stageResults[index], 5);
+
+		for(uint8_t index = 0; index < counterCount; ++index)
+			detail::printPadded(printer, profile.counterResults[index].average, 7);
+	}
+
+	/// Times a stage from construction to destruction.
+	/// Does nothing unless the profiler is built in.
+	class ScopedTimer
+	{
+	private:
+		Stage stage;
+		uint32_t start;
+
+	public:
+		explicit ScopedTimer(Stage stage) :
+			stage{stage}, start{isEnabled() ? micros() : 0}
+		{
+		}
+
+		ScopedTimer(const ScopedTimer &) = delete;
+		ScopedTimer & operator =(const ScopedTimer &) = delete;
+
+		~ScopedTimer()
+		{
+			if(isEnabled())
+				addTime(this->stage, (micros() - this->start));
+		}
+	};
+}
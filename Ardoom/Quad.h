@@ -1,8 +1,8 @@
-#pragma once
-
-#include "Geometry.h"
-
-struct Quad
-{
-	Point2F points[4];
+#pragma once
+
+#include "Geometry.h"
+
+struct Quad
+{
+	Point2SQ15x16 points[4];
 };
\ No newline at end of file
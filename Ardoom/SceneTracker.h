@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Geometry.h"
+#include "Camera.h"
+#include "BinaryAngle.h"
+#include "CommonTypes.h"
+
+/// Tells whether the next frame would look the same as the last one drawn,
+/// so that drawing it and sending it to the display can be skipped,
+/// leaving the last frame in the frame buffer and on the display.
+/// The camera is compared with the one the last frame was drawn from.
+/// Anything else that changes the picture, such as entities moving, must be reported with invalidate.
+class SceneTracker
+{
+private:
+	// The camera that the last frame was drawn from
+	Point2SQ15x16 position;
+	BinaryAngleU16 angle { 0 };
+	SectorId sector = noSector;
+	SQ15x16 height;
+
+	bool isDrawn = false;
+
+public:
+	/// Marks the last frame as out of date.
+	void invalidate()
+	{
+		this->isDrawn = false;
+	}
+
+	/// Checks whether a frame drawn from the camera would differ from the last one drawn.
+	bool isChanged(const Camera & camera) const
+	{
+		return (!this->isDrawn || (camera.position != this->position) || (camera.getAngle() != this->angle) || (camera.sector != this->sector) || (camera.height != this->height));
+	}
+
+	/// Records that a frame has been drawn from the camera.
+	void setDrawn(const Camera & camera)
+	{
+		this->position = camera.position;
+		this->angle = camera.getAngle();
+		this->sector = camera.sector;
+		this->height = camera.height;
+		this->isDrawn = true;
+	}
+};
\ No newline at end of file
@@ -1,41 +1,130 @@
-#pragma once
-
-#include <stddef.h>
-#include <stdint.h>
-
-#include "Geometry.h"
-
-class Sector
-{
-public:
-	static constexpr uint8_t maxPoints = 16;
-
-private:
-	const unsigned char * data;
-	uint8_t pointCount;
-
-public:
-	Sector(const unsigned char * data) :
-		data{&data[1]}, pointCount{pgm_read_byte(&data[0])}
-	{
-		//this->z = pgm_read_byte(&sectorPointer[1]);
-		//this->height = pgm_read_byte(&sectorPointer[2]);
-	}
-
-	constexpr Sector(const unsigned char * data, uint8_t pointCount) :
-		data { data }, pointCount { pointCount }
-	{
-	}
-
-	constexpr uint8_t getPointCount() const
-	{
-		return  this->pointCount;
-	}
-
-	Point2F getPoint(uint8_t index) const
-	{
-		// TODO: fix this
-		// Temporary implementation for the sake of testing
-		return { pgm_read_byte(&this->data[(index * 2) + 0]), pgm_read_byte(&this->data[(index * 2) + 1]) };
-	}
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "Geometry.h"
+#include "FixedPoints.h"
+#include "CommonTypes.h"
+#include "LevelFormat.h"
+
+// Reads a sector in the compiled level format (see LevelFormat.h).
+// Each edge runs from its point to the next, the last edge closing the loop.
+// The neighbour of an edge is the sector on the other side of it,
+// or noSector if the edge is a solid wall.
+class Sector
+{
+public:
+	static constexpr uint8_t maxPoints = 16;
+
+private:
+	const uint8_t * data;
+	uint8_t pointCount;
+
+public:
+	Sector(const uint8_t * data) :
+		data{data}, pointCount{pgm_read_byte(&data[levelformat::sector::pointCount])}
+	{
+	}
+
+	constexpr uint8_t getPointCount() const
+	{
+		return  this->pointCount;
+	}
+
+	Point2SQ15x16 getPoint(uint8_t index) const
+	{
+		const uint8_t * edge = this->getEdge(index);
+
+		return { levelformat::readSQ15x16(&edge[levelformat::edge::x]), levelformat::readSQ15x16(&edge[levelformat::edge::y]) };
+	}
+
+	/// Gets the unit normal of the edge that starts at the given point.
+	/// The normal points into the sector.
+	Vector2SQ15x16 getNormal(uint8_t index) const
+	{
+		const uint8_t * edge = this->getEdge(index);
+
+		return { levelformat::readSQ15x16(&edge[levelformat::edge::normalX]), levelformat::readSQ15x16(&edge[levelformat::edge::normalY]) };
+	}
+
+	/// Gets the length of the edge that starts at the given point.
+	SQ15x16 getLength(uint8_t index) const
+	{
+		return levelformat::readSQ15x16(&this->getEdge(index)[levelformat::edge::length]);
+	}
+
+	/// Gets the amount that distances along the edge that starts at the given point are scaled by for texturing.
+	SQ7x8 getTextureScale(uint8_t index) const
+	{
+		return SQ7x8::fromInternal(static_cast<int16_t>(pgm_read_word(&this->getEdge(index)[levelformat::edge::textureScale])));
+	}
+
+	/// Gets the sector on the other side of the edge that starts at the given point.
+	SectorId getNeighbour(uint8_t index) const
+	{
+		return pgm_read_byte(&this->getEdge(index)[levelformat::edge::neighbour]);
+	}
+
+	Point2SQ15x16 getMinimum() const
+	{
+		return { levelformat::readSQ15x16(&this->data[levelformat::sector::minimumX]), levelformat::readSQ15x16(&this->data[levelformat::sector::minimumY]) };
+	}
+
+	Point2SQ15x16 getMaximum() const
+	{
+		return { levelformat::readSQ15x16(&this->data[levelformat::sector::maximumX]), levelformat::readSQ15x16(&this->data[levelformat::sector::maximumY]) };
+	}
+
+	SQ7x8 getFloorHeight() const
+	{
+		return SQ7x8::fromInternal(static_cast<int16_t>(pgm_read_word(&this->data[levelformat::sector::floorHeight])));
+	}
+
+	SQ7x8 getCeilingHeight() const
+	{
+		return SQ7x8::fromInternal(static_cast<int16_t>(pgm_read_word(&this->data[levelformat::sector::ceilingHeight])));
+	}
+
+	/// Gets how bright the sector's surfaces are at a depth of 1, out of dither::levelCount.
+	/// They grow darker in proportion to their distance.
+	uint8_t getLight() const
+	{
+		return pgm_read_byte(&this->data[levelformat::sector::light]);
+	}
+
+	/// Gets the PointId of the sector's first point.
+	/// The rest follow it in order, so every point of the level has its own.
+	PointId getFirstPoint() const
+	{
+		return pgm_read_word(&this->data[levelformat::sector::firstPoint]);
+	}
+
+	/// Checks if a point is inside the sector.
+	/// Points outside the bounding box are rejected without visiting the edges.
+	bool contains(const Point2SQ15x16 & point) const
+	{
+		if(this->pointCount == 0)
+			return false;
+
+		const Point2SQ15x16 minimum = this->getMinimum();
+		const Point2SQ15x16 maximum = this->getMaximum();
+
+		if((point.x < minimum.x) || (point.y < minimum.y) || (point.x > maximum.x) || (point.y > maximum.y))
+			return false;
+
+		// The point must be on the inner side of every edge
+		for(uint8_t index = 0; index < this->pointCount; ++index)
+			if(dotProduct((point - this->getPoint(index)), this->getNormal(index)) < 0)
+				return false;
+
+		return true;
+	}
+
+private:
+	const uint8_t * getEdge(uint8_t index) const
+	{
+		return &this->data[levelformat::sector::edges + (index * levelformat::edge::size)];
+	}
 };
\ No newline at end of file
@@ -1,147 +1,1084 @@
-#pragma once
-
-#include "Constants.h"
-#include "Geometry.h"
-#include "Camera.h"
-#include "Sector.h"
-#include "Maths.h"
-
-template<typename Renderer>
-struct SectorRenderer
-{
-	// TODO: Eliminate the array by fusing the two loops
-	static void render3D(Renderer & renderer, const Camera & camera, const Sector & sector)
-	{
-		// Allocate a point buffer
-		Point2F pointsTransformed[Sector::maxPoints];
-
-		// Cache the sine and cosine to avoid recalculation
-		const float cosine = cos(-camera.angle);
-		const float sine = sin(-camera.angle);
-
-		for(uint8_t i = 0; i < sector.getPointCount(); ++i)
-		{
-			const Point2F & point = sector.getPoint(i);
-
-			// Translate local to camera
-			const Vector2F cameraOffset = (point - camera.position);
-
-			// Rotate around camera
-			const Point2F rotatedPoint { (cameraOffset.x * cosine) - (cameraOffset.y * sine), (cameraOffset.x * sine) + (cameraOffset.y * cosine) };
-
-			pointsTransformed[i] = rotatedPoint;
-		}
-
-		// Cache the screen dimensions
-		const uint8_t screenWidth = renderer.width();
-		const uint8_t screenHeight = renderer.height();
-		const uint8_t halfScreenWidth = (screenWidth / 2);
-		const uint8_t halfScreenHeight = (screenHeight / 2);
-
-		// Calculate the centre of the screen
-		const Point2F screenCentre { halfScreenWidth, halfScreenHeight };
-
-		const float viewWidth = screenWidth;
-		const float viewHeight = screenHeight;
-
-		for(uint8_t i = 0, j = 1; i < sector.getPointCount(); ++i, ++j)
-		{
-			if(j == sector.getPointCount())
-				j = 0;
-
-			// Don't render if both vertices are off screen
-			if((pointsTransformed[i].x <= 0) && (pointsTransformed[j].x <= 0))
-				continue;
-
-			// TODO: Multiply by the inverse
-			// const float inverseY = (1.0f / pointsTransformed[i].y);
-			// const float inverseFOV = (viewWidth * inverseY);
-			// const float inverseHeight = (viewHeight * inverseY);
-
-			const auto adjustedStartX = (pointsTransformed[i].x <= 0) ? 1.0f : pointsTransformed[i].x;
-
-			// TODO: consider decomposing 'maths::map' to reduce the number of calculations involved
-			// (The compiler is probably doing this already)
-			const auto adjustedStartY = (pointsTransformed[i].x <= 0) ? maths::map(1.0f, pointsTransformed[i].x, pointsTransformed[j].x, pointsTransformed[i].y, pointsTransformed[j].y) : pointsTransformed[i].y;
-
-			const auto startX = (adjustedStartY * (viewWidth / adjustedStartX));
-			const auto startLineHeight = (viewHeight / adjustedStartX);
-
-			const auto adjustedEndX = (pointsTransformed[j].x <= 0) ? 1.0f : pointsTransformed[j].x;
-
-			// TODO: consider decomposing 'maths::map' to reduce the number of calculations involved
-			// (The compiler is probably doing this already)
-			const auto adjustedEndY = (pointsTransformed[j].x <= 0) ? maths::map(1.0f, pointsTransformed[i].x, pointsTransformed[j].x, pointsTransformed[i].y, pointsTransformed[j].y) : pointsTransformed[j].y;
-
-			const auto endX = (adjustedEndY * (viewWidth / adjustedEndX));
-			const auto endLineHeight = (viewHeight / adjustedEndX);
-
-			const auto startRight = (screenCentre.x + startX);
-			const auto startTop = (screenCentre.y - startLineHeight);
-			const auto startBottom = (screenCentre.y + startLineHeight);
-
-			const auto endRight = (screenCentre.x + endX);
-			const auto endTop = (screenCentre.y - endLineHeight);
-			const auto endBottom = (screenCentre.y + endLineHeight);
-
-			// Top
-			renderer.drawLine(startRight, startTop, endRight, endTop);
-
-			// Bottom
-			renderer.drawLine(startRight, startBottom, endRight, endBottom);
-
-			// Left
-			renderer.drawFastVLine(startRight, startTop, startLineHeight * 2);
-
-			// Right
-			renderer.drawFastVLine(endRight, endTop, endLineHeight * 2);
-
-			// Debug info: identify which map coordinate you're looking at
-			const Point2F & point = sector.getPoint(i);
-			renderer.setCursor(startRight, startTop - 8);
-			renderer.print(point.x);
-			renderer.setCursor(startRight, startTop);
-			renderer.print(point.y);
-		}
-
-		renderer.drawPixel(screenCentre.x, screenCentre.y);
-	}
-
-	// TODO: Eliminate the array by fusing the two loops
-	static void render2D(Renderer & renderer, const Camera & camera, const Sector & sector)
-	{
-		// Calculate the centre of the screen
-		const Point2F screenCentre { static_cast<float>(renderer.width() / 2), static_cast<float>(renderer.height() / 2) };
-
-		// Allocate a point buffer
-		Point2F pointsTransformed[Sector::maxPoints];
-
-		// Transform the points
-		for(uint8_t i = 0; i < sector.getPointCount(); ++i)
-		{
-			const Point2F & point = sector.getPoint(i);
-			pointsTransformed[i] = (screenCentre + (point - camera.position));
-		}
-
-		// Render the points
-		for(uint8_t i = 0, j = 1; i < sector.getPointCount(); ++i, ++j)
-		{
-			if(j == sector.getPointCount())
-				j = 0;
-
-			renderer.drawLine(pointsTransformed[i].x, pointsTransformed[i].y, pointsTransformed[j].x, pointsTransformed[j].y);
-		}
-
-		// TODO: Find a better place to put this
-		constexpr float lineLength = 4;
-
-		// Calculate the direction vector of the camera
-		const Vector2F cameraDirection { cos(camera.angle), sin(camera.angle) };
-
-		// Calculate the end point of the line representing the player
-		const Point2U8 endPoint = static_cast<Point2U8>(screenCentre + (cameraDirection * lineLength));
-
-		// Render the camera line
-		renderer.drawLine(screenCentre.x, screenCentre.y, endPoint.x, endPoint.y);
-	}
+#pragma once
+
+#include "Constants.h"
+#include "Geometry.h"
+#include "Camera.h"
+#include "Sector.h"
+#include "Level.h"
+#include "Bsp.h"
+#include "OcclusionBuffer.h"
+#include "DepthBuffer.h"
+#include "VertexCache.h"
+#include "CullStatistics.h"
+#include "WallPolicies.h"
+#include "Maths.h"
+#include "Profiler.h"
+#include "DebugOverlay.h"
+#include "FlatShading.h"
+#include "Dither.h"
+#include "SectorRendererConfig.h"
+#include "Traits.h"
+
+// Config is a set of compile time settings (see SectorRendererConfig.h)
+template<typename Renderer, typename Config = DefaultSectorRendererConfig>
+struct SectorRenderer
+{
+private:
+	struct Projection
+	{
+		// The horizontal position on screen
+		SQ15x16 screenX;
+
+		// Half the height of one unit of wall at this depth, which the edges of walls are scaled from
+		SQ15x16 halfHeight;
+	};
+
+	struct Vertex
+	{
+		// The position within the sector
+		Point2SQ15x16 point;
+
+		// The position relative to the camera, with x being the depth
+		Point2SQ15x16 transformed;
+
+		// Whether the projection has been calculated.
+		// Vertices are only projected once a wall using them passes culling,
+		// and never if they are nearer than the near plane.
+		bool isProjected;
+
+		Projection projection;
+	};
+
+	// A sector's ceiling and floor as seen from the camera: how far each is above and below the eye,
+	// measured in half units, so that multiplying by a projected half height gives their offsets from the centre of the screen.
+	// A floor at 0 and a ceiling at 1, with the eye halfway between them, are both 1.
+	struct Heights
+	{
+		SQ15x16 ceiling;
+		SQ15x16 floor;
+	};
+
+	struct Wall
+	{
+		Vertex & start;
+		Vertex & end;
+
+		// The heights of the wall's sector and, for a portal, of the sector across it
+		Heights heights;
+		Heights neighbourHeights;
+
+		// The light of the wall's sector
+		uint8_t light;
+
+		// The sector across the wall, or noSector if it is solid
+		SectorId neighbour;
+
+		// Whether each end of the wall is a corner to be outlined
+		bool hasStartCorner;
+		bool hasEndCorner;
+
+		// The distance along the wall at each end, scaled for texturing.
+		// Only needed by textured wall policies.
+		SQ15x16 startU;
+		SQ15x16 endU;
+	};
+
+	// A screen position that changes linearly across the columns of a wall
+	struct ProjectedEdge
+	{
+		// The row at the wall's start column, and how much it changes per column
+		SQ15x16 row;
+		SQ15x16 step;
+	};
+
+	// A wall projected onto the screen, ready to be stepped across its columns
+	struct ProjectedWall
+	{
+		// The columns the wall covers, from startColumn (inclusive) to endColumn (exclusive)
+		uint8_t startColumn;
+		uint8_t endColumn;
+
+		// Whether the first and last columns hold corners to be outlined
+		bool hasStartCorner;
+		bool hasEndCorner;
+
+		// The half height and projectedU at the start column, and how much they change per column
+		SQ15x16 halfHeight;
+		SQ15x16 heightStep;
+		SQ15x16 projectedU;
+		SQ15x16 projectedUStep;
+
+		// The wall's top and bottom edges, at its sector's ceiling and floor
+		ProjectedEdge top;
+		ProjectedEdge bottom;
+
+		// The brightness at the start column, and how much it changes per column.
+		// Only calculated for lit walls.
+		SQ15x16 brightness;
+		SQ15x16 brightnessStep;
+	};
+
+	using Overlay = traits::conditional_t<Config::isDebugOverlayDrawn(), DebugOverlay<Config::debugOverlayCapacity()>, NullDebugOverlay>;
+	using Flats = traits::conditional_t<Config::areFlatsDrawn(), FlatShading<Renderer::height()>, NullFlatShading>;
+
+public:
+	/// Keeps the level's points rotated into the camera's basis from frame to frame (see VertexCache.h).
+	using TransformCache = VertexCache<Config::vertexCacheCapacity()>;
+
+private:
+
+	template<typename WallPolicy>
+	struct Context
+	{
+		Renderer & renderer;
+		const Camera & camera;
+		const Level & level;
+		const WallPolicy & wallPolicy;
+		OcclusionBuffer<Renderer::width()> occlusion;
+		CullStatistics statistics;
+
+		// Where the depth of the wall in each column is recorded, or nullptr
+		DepthBuffer<Renderer::width()> * depthBuffer;
+
+		// Where the sectors' points are kept rotated between frames, or nullptr
+		TransformCache * transformCache;
+
+		// The camera's position in its own basis, which is subtracted from every point
+		Point2SQ15x16 cameraInBasis;
+
+		// The patterns that flats are filled with
+		Flats flats;
+
+		// Numbers to draw over the scene once it is finished
+		Overlay overlay;
+	};
+
+	static_assert
+	(
+		traits::disjunction<traits::is_same<typename Config::Clipping, NearPlaneClipping>, traits::is_same<typename Config::Clipping, GuardBandClipping>>::value,
+		"Config::Clipping must be NearPlaneClipping or GuardBandClipping"
+	);
+
+public:
+	/// Points one unit to the side of the camera at a depth of 1 are this many pixels from the centre of the screen.
+	/// Anything drawn alongside the walls must be projected with the same scale.
+	static constexpr uint16_t projectionScale()
+	{
+		return ((Renderer::width() / 2) * Config::viewSlope());
+	}
+
+	/// Renders the level as seen from the camera's sector.
+	/// Sectors are visited front to back, and only if they can be seen through a portal.
+	/// Every column is closed by the first solid wall drawn in it,
+	/// so nothing is drawn over, and rendering stops once every column is closed.
+	/// The wall policy decides how each column of a solid wall is drawn.
+	/// Walls run from their sector's floor to its ceiling, as seen from the camera's height.
+	/// Where the sector across a portal has a lower ceiling or a higher floor, the step is drawn as a wall.
+	/// If the config draws flats, each sector's floor and ceiling are filled around its walls and portals.
+	/// The debug overlay, if the config has one, is drawn last.
+	/// Given a depth buffer, records the depth of the solid wall in each column, for drawing sprites.
+	/// Given a transform cache, keeps the sectors' points in it, which saves rotating them again
+	/// in later frames drawn with the camera at the same angle. The cache must be reset when the level changes.
+	/// Returns how many walls were culled before being projected.
+	template<typename WallPolicy = typename Config::WallPolicy>
+	static CullStatistics render3D(Renderer & renderer, const Camera & camera, const Level & level, const WallPolicy & wallPolicy = WallPolicy(), DepthBuffer<Renderer::width()> * depthBuffer = nullptr, TransformCache * transformCache = nullptr)
+	{
+		Context<WallPolicy> context { renderer, camera, level, wallPolicy, {}, {}, depthBuffer, transformCache, camera.toBasis(camera.position), {}, {} };
+		context.occlusion.reset(renderer.height());
+		context.flats.update(projectionScale());
+
+		if(depthBuffer != nullptr)
+			depthBuffer->reset();
+
+		if(transformCache != nullptr)
+			transformCache->update(camera);
+
+		context.overlay.add(0, 0, camera.sector);
+
+		if(camera.sector < level.getSectorCount())
+			renderSector3D(context, camera.sector, 0, renderer.width(), 0);
+
+		renderer.drawPixel((renderer.width() / 2), (renderer.height() / 2));
+
+		context.overlay.draw(renderer);
+
+		return context.statistics;
+	}
+
+	/// Renders the level by walking its BSP tree from the camera's position,
+	/// which visits walls front to back without following portals.
+	/// Branches whose bounding box lies outside of the view are skipped,
+	/// and rendering stops once every column is closed.
+	/// Segments facing away from the camera are rejected before they are transformed.
+	/// Levels without a BSP tree are rendered with render3D.
+	/// Segments aren't points of sectors, so there is no transform cache.
+	/// Returns how many walls were culled before being projected.
+	template<typename WallPolicy = typename Config::WallPolicy>
+	static CullStatistics render3DBsp(Renderer & renderer, const Camera & camera, const Level & level, const WallPolicy & wallPolicy = WallPolicy(), DepthBuffer<Renderer::width()> * depthBuffer = nullptr)
+	{
+		const Bsp bsp = level.getBsp();
+
+		if(bsp.isEmpty())
+			return render3D(renderer, camera, level, wallPolicy, depthBuffer);
+
+		Context<WallPolicy> context { renderer, camera, level, wallPolicy, {}, {}, depthBuffer, nullptr, camera.toBasis(camera.position), {}, {} };
+		context.occlusion.reset(renderer.height());
+		context.flats.update(projectionScale());
+
+		if(depthBuffer != nullptr)
+			depthBuffer->reset();
+
+		context.overlay.add(0, 0, camera.sector);
+
+		renderBspChild3D(context, bsp, bsp.getRoot());
+
+		renderer.drawPixel((renderer.width() / 2), (renderer.height() / 2));
+
+		context.overlay.draw(renderer);
+
+		return context.statistics;
+	}
+
+	/// Renders a map of the whole level, centred on the camera.
+	/// The line policy decides how the lines are drawn.
+	template<typename LinePolicy = typename Config::LinePolicy>
+	static void render2D(Renderer & renderer, const Camera & camera, const Level & level, const LinePolicy & linePolicy = LinePolicy())
+	{
+		// Calculate the centre of the screen
+		const Point2SQ15x16 screenCentre { static_cast<uint8_t>(renderer.width() / 2), static_cast<uint8_t>(renderer.height() / 2) };
+
+		for(SectorId sector = 0; sector < level.getSectorCount(); ++sector)
+			renderSector2D(renderer, camera, level.getSector(sector), sector, screenCentre, linePolicy);
+
+		// TODO: Find a better place to put this
+		constexpr SQ15x16 lineLength = 4;
+
+		// Get the direction vector of the camera
+		const Vector2SQ15x16 & cameraDirection = camera.getForward();
+
+		// Calculate the end point of the line representing the player
+		const Point2U8 endPoint = static_cast<Point2U8>(screenCentre + (cameraDirection * lineLength));
+
+		// Render the camera line
+		linePolicy.drawLine(renderer, static_cast<int16_t>(screenCentre.x), static_cast<int16_t>(screenCentre.y), endPoint.x, endPoint.y);
+	}
+
+private:
+	// Rotating comes before translating, so that a point's rotation doesn't depend on where the camera is.
+	// Points of sectors are looked up in the transform cache by their PointId, if there is one.
+	// Either way the result is the same.
+	template<typename WallPolicy>
+	static Vertex transformVertex(Context<WallPolicy> & context, const Point2SQ15x16 & point, PointId pointId)
+	{
+		const profiler::ScopedTimer timer { profiler::Stage::Transform };
+
+		const Camera & camera = context.camera;
+
+		const Point2SQ15x16 rotated = ((context.transformCache != nullptr) && (pointId != noPoint)) ?
+			context.transformCache->getRotated(camera, pointId, point) :
+			camera.toBasis(point);
+
+		const Vector2SQ15x16 transformed = (rotated - context.cameraInBasis);
+
+		Vertex vertex;
+		vertex.point = point;
+		vertex.transformed = { transformed.x, transformed.y };
+		vertex.isProjected = false;
+
+		return vertex;
+	}
+
+	// Projects a vertex at or beyond the near plane.
+	// The projection is kept, so walls sharing a vertex share the reciprocal.
+	static const Projection & projectVertex(Renderer & renderer, Vertex & vertex)
+	{
+		if(!vertex.isProjected)
+		{
+			vertex.projection = project(renderer, vertex.transformed.y, maths::reciprocal(vertex.transformed.x));
+			vertex.isProjected = true;
+		}
+
+		return vertex.projection;
+	}
+
+	static Projection project(Renderer & renderer, SQ15x16 y, SQ15x16 inverseDepth)
+	{
+		const SQ15x16 halfScreenWidth = static_cast<uint8_t>(renderer.width() / 2);
+
+		// One unit of wall has the half height of half a unit to the side
+		const SQ15x16 viewWidth = projectionScale();
+		const SQ15x16 viewHeight = (projectionScale() / 2);
+
+		return { (halfScreenWidth + (y * (viewWidth * inverseDepth))), (viewHeight * inverseDepth) };
+	}
+
+	// Projects the point a fraction of the way along a wall from its start,
+	// where the wall was clipped
+	static Projection projectClipped(Renderer & renderer, const Point2SQ15x16 & start, const Point2SQ15x16 & end, SQ15x16 fraction)
+	{
+		const SQ15x16 x = maths::lerp(start.x, end.x, fraction);
+		const SQ15x16 y = maths::lerp(start.y, end.y, fraction);
+
+		return project(renderer, y, maths::reciprocal(x));
+	}
+
+	// Gets the first column at or after a screen position within the screen
+	static uint8_t getColumn(SQ15x16 x)
+	{
+		return static_cast<uint8_t>((x.getInternal() + (SQ15x16::scale - 1)) >> SQ15x16::fractionSize);
+	}
+
+	// Gets the row containing a screen position, limited to one row beyond either edge of the screen
+	static int16_t getRow(SQ15x16 y)
+	{
+		if(y < -1)
+			return -1;
+
+		if(y > Renderer::height())
+			return Renderer::height();
+
+		return static_cast<int16_t>(y);
+	}
+
+	// Multiplying by 2 turns units into half units
+	template<typename WallPolicy>
+	static Heights getHeights(Context<WallPolicy> & context, const Sector & sector)
+	{
+		const SQ15x16 eye = context.camera.height;
+
+		return { ((SQ15x16(sector.getCeilingHeight()) - eye) * 2), ((eye - SQ15x16(sector.getFloorHeight())) * 2) };
+	}
+
+	// Each vertex is read and transformed once.
+	// Only the previous vertex and the first vertex are kept,
+	// the first being needed to close the loop.
+	template<typename WallPolicy>
+	static void renderSector3D(Context<WallPolicy> & context, SectorId sectorId, uint8_t left, uint8_t right, uint8_t depth)
+	{
+		const Sector sector = context.level.getSector(sectorId);
+		const uint8_t pointCount = sector.getPointCount();
+
+		if(pointCount == 0)
+			return;
+
+		const Heights heights = getHeights(context, sector);
+
+		const PointId firstPoint = sector.getFirstPoint();
+
+		Vertex first = transformVertex(context, sector.getPoint(0), firstPoint);
+		const SectorId firstNeighbour = sector.getNeighbour(0);
+
+		Vertex previous = first;
+		SectorId neighbour = firstNeighbour;
+
+		for(uint8_t index = 1; index < pointCount; ++index)
+		{
+			// Stop once there is nothing left to draw
+			if(context.occlusion.isComplete())
+				return;
+
+			Vertex current = transformVertex(context, sector.getPoint(index), (firstPoint + index));
+			const SectorId nextNeighbour = sector.getNeighbour(index);
+
+			renderEdge3D(context, sector, heights, (index - 1), previous, current, neighbour, nextNeighbour, left, right, depth);
+
+			previous = current;
+			neighbour = nextNeighbour;
+		}
+
+		renderEdge3D(context, sector, heights, (pointCount - 1), previous, first, neighbour, firstNeighbour, left, right, depth);
+	}
+
+	// The edge is the wall's index within the sector, for looking up its precomputed data.
+	// The next neighbour is that of the following wall,
+	// which decides whether the corner at the end of this wall is visible.
+	// Portals are followed into the sector beyond them.
+	template<typename WallPolicy>
+	static void renderEdge3D(Context<WallPolicy> & context, const Sector & sector, const Heights & heights, uint8_t edge, Vertex & start, Vertex & end, SectorId neighbour, SectorId nextNeighbour, uint8_t left, uint8_t right, uint8_t depth)
+	{
+		Wall wall { start, end, heights, heights, sector.getLight(), neighbour, true, (nextNeighbour != noSector), 0, 0 };
+
+		if(neighbour != noSector)
+			wall.neighbourHeights = getHeights(context, context.level.getSector(neighbour));
+
+		if(WallPolicy::isTextured())
+			// The texture scale stretches the wall's length rather than the texture
+			wall.endU = (sector.getLength(edge) * SQ15x16(sector.getTextureScale(edge)));
+
+		// Left empty unless the wall is visible
+		uint8_t startColumn = right;
+		uint8_t endColumn = left;
+
+		const bool isVisible = renderWall3D(context, wall, left, right, startColumn, endColumn);
+
+		if((neighbour == noSector) || (depth >= Config::maxPortalDepth()))
+			return;
+
+		// The part of a portal nearer than the near plane isn't drawn, but the sector beyond is still seen through it
+		const bool isNear = ((start.transformed.x < Config::nearDepth()) || (end.transformed.x < Config::nearDepth()));
+
+		uint8_t nearStartColumn;
+		uint8_t nearEndColumn;
+
+		if(isNear && getPortalColumns(context, wall, left, right, nearStartColumn, nearEndColumn))
+		{
+			// Rounded differently, so both sets of columns are kept
+			startColumn = (startColumn < nearStartColumn) ? startColumn : nearStartColumn;
+			endColumn = (endColumn > nearEndColumn) ? endColumn : nearEndColumn;
+		}
+		else if(!isVisible)
+		{
+			return;
+		}
+
+		if(context.occlusion.isAnyOpen(startColumn, endColumn))
+			renderSector3D(context, neighbour, startColumn, endColumn, (depth + 1));
+	}
+
+	// Gets the columns between left and right that the whole of a portal covers, including any part nearer than the near plane.
+	// A wall facing the camera runs from left to right across the screen,
+	// so an end behind the camera reaches the edge of the screen on its side.
+	// A portal that the camera stands in covers every column.
+	// Which side of the portal the camera is on is found from the level's points, which aren't rounded by rotating them.
+	// Returns false if the portal covers none of the columns.
+	template<typename WallPolicy>
+	static bool getPortalColumns(Context<WallPolicy> & context, const Wall & wall, uint8_t left, uint8_t right, uint8_t & startColumn, uint8_t & endColumn)
+	{
+		const Point2SQ15x16 & position = context.camera.position;
+		const Point2SQ15x16 startOffset { (wall.start.point.x - position.x), (wall.start.point.y - position.y) };
+		const Point2SQ15x16 endOffset { (wall.end.point.x - position.x), (wall.end.point.y - position.y) };
+
+		const SQ15x16::IntermediateType cross = getCrossProduct(startOffset, endOffset);
+
+		if(cross < 0)
+			return false;
+
+		if(cross == 0)
+		{
+			// Seen edge on, unless its ends are on either side of the camera, or one of them is where the camera is
+			const bool isAlongside =
+				((startOffset.x > 0) && (endOffset.x > 0)) || ((startOffset.x < 0) && (endOffset.x < 0)) ||
+				((startOffset.y > 0) && (endOffset.y > 0)) || ((startOffset.y < 0) && (endOffset.y < 0));
+
+			startColumn = left;
+			endColumn = right;
+
+			return !isAlongside;
+		}
+
+		const Point2SQ15x16 & start = wall.start.transformed;
+		const Point2SQ15x16 & end = wall.end.transformed;
+
+		if((start.x <= 0) && (end.x <= 0))
+			return false;
+
+		startColumn = (start.x <= 0) ? left : getLimitedColumn(start, left, right);
+		endColumn = (end.x <= 0) ? right : getLimitedColumn(end, left, right);
+
+		return (startColumn < endColumn);
+	}
+
+	// Gets the first column at or after a point in front of the camera, limited to between left and right.
+	// Points beyond the edges of the view aren't projected, and the ratio of the side to the depth is taken first,
+	// so points nearer than the near plane can't overflow.
+	static uint8_t getLimitedColumn(const Point2SQ15x16 & point, uint8_t left, uint8_t right)
+	{
+		const SQ15x16 side = (point.y * Config::viewSlope());
+
+		if(side <= -point.x)
+			return left;
+
+		if(side >= point.x)
+			return right;
+
+		const SQ15x16 screenX = (static_cast<uint8_t>(Renderer::width() / 2) + ((point.y * maths::reciprocal(point.x)) * projectionScale()));
+		const uint8_t column = getColumn(screenX);
+
+		return (column < left) ? left : (column > right) ? right : column;
+	}
+
+	template<typename WallPolicy>
+	static void renderBspChild3D(Context<WallPolicy> & context, const Bsp & bsp, uint16_t child)
+	{
+		// Stop once there is nothing left to draw
+		if(context.occlusion.isComplete())
+			return;
+
+		if(Bsp::isLeaf(child))
+			renderBspLeaf3D(context, bsp, child);
+		else
+			renderBspNode3D(context, bsp, child);
+	}
+
+	// The side of the partition that the camera is on is nearer, so it is drawn first
+	template<typename WallPolicy>
+	static void renderBspNode3D(Context<WallPolicy> & context, const Bsp & bsp, uint16_t index)
+	{
+		const BspNode node = bsp.getNode(index);
+		const bool front = node.isInFront(context.camera.position);
+
+		if(isBoxVisible(context, node, front))
+			renderBspChild3D(context, bsp, node.getChild(front));
+
+		if(isBoxVisible(context, node, !front))
+			renderBspChild3D(context, bsp, node.getChild(!front));
+	}
+
+	// Segments within a leaf can't hide each other, so their order doesn't matter.
+	// A segment is seen from the side its edge's normal points to, into its sector,
+	// so the camera's side of it is found from the level's points alone, before transforming them.
+	// Back facing segments are counted as such, whatever else they would fail.
+	template<typename WallPolicy>
+	static void renderBspLeaf3D(Context<WallPolicy> & context, const Bsp & bsp, uint16_t child)
+	{
+		uint16_t firstSegment;
+		uint8_t segmentCount;
+
+		bsp.getLeaf(child, firstSegment, segmentCount);
+
+		for(uint16_t index = firstSegment; index < (firstSegment + segmentCount); ++index)
+		{
+			const BspSegment segment = bsp.getSegment(index);
+			const Sector sector = context.level.getSector(segment.getSector());
+			const Point2SQ15x16 startPoint = segment.getStart();
+
+			if(dotProduct((context.camera.position - startPoint), sector.getNormal(segment.getEdge())) <= 0)
+			{
+				++context.statistics.walls;
+				++context.statistics.backFacing;
+				continue;
+			}
+
+			const uint8_t flags = segment.getFlags();
+
+			// Segments aren't points of sectors, so they aren't cached
+			Vertex start = transformVertex(context, startPoint, noPoint);
+			Vertex end = transformVertex(context, segment.getEnd(), noPoint);
+
+			const SectorId neighbour = segment.getNeighbour();
+			const Heights heights = getHeights(context, sector);
+
+			Wall wall
+			{
+				start, end,
+				heights,
+				(neighbour != noSector) ? getHeights(context, context.level.getSector(neighbour)) : heights,
+				sector.getLight(),
+				neighbour,
+				((flags & levelformat::segment::startsAfterWall) != 0),
+				((flags & levelformat::segment::endsBeforePortal) != 0),
+				0, 0,
+			};
+
+			if(WallPolicy::isTextured())
+			{
+				wall.startU = segment.getStartU();
+				wall.endU = segment.getEndU();
+			}
+
+			uint8_t startColumn;
+			uint8_t endColumn;
+
+			renderWall3D(context, wall, 0, context.renderer.width(), startColumn, endColumn);
+		}
+	}
+
+	// Checks whether any of the box around one side of a partition is within the view.
+	template<typename WallPolicy>
+	static bool isBoxVisible(Context<WallPolicy> & context, const BspNode & node, bool front)
+	{
+		Point2SQ15x16 minimum;
+		Point2SQ15x16 maximum;
+
+		node.getBox(front, minimum, maximum);
+
+		const Camera & camera = context.camera;
+		const Point2SQ15x16 & position = camera.position;
+
+		// The camera can always see the space around it
+		if((position.x >= minimum.x) && (position.y >= minimum.y) && (position.x <= maximum.x) && (position.y <= maximum.y))
+			return true;
+
+		const Point2SQ15x16 corners[]
+		{
+			{ minimum.x, minimum.y },
+			{ maximum.x, minimum.y },
+			{ maximum.x, maximum.y },
+			{ minimum.x, maximum.y },
+		};
+
+		Renderer & renderer = context.renderer;
+
+		bool anyInFront = false;
+		bool allInFront = true;
+		bool anyRightOfLeftEdge = false;
+		bool anyLeftOfRightEdge = false;
+
+		// The range of screen positions covered by the box, if it is in front of the camera
+		SQ15x16 leftmost = renderer.width();
+		SQ15x16 rightmost = 0;
+
+		for(const Point2SQ15x16 & corner : corners)
+		{
+			const Vector2SQ15x16 offset = (corner - position);
+
+			const SQ15x16 depth = dotProduct(offset, camera.getForward());
+			const SQ15x16 side = (dotProduct(offset, camera.getRight()) * Config::viewSlope());
+
+			anyInFront = (anyInFront || (depth > 0));
+			anyRightOfLeftEdge = (anyRightOfLeftEdge || (side > -depth));
+			anyLeftOfRightEdge = (anyLeftOfRightEdge || (side < depth));
+
+			if(depth < Config::nearDepth())
+			{
+				allInFront = false;
+				continue;
+			}
+
+			// Limited to just beyond the screen, which keeps the projection within range
+			const SQ15x16 ratio = (side * maths::reciprocal(depth));
+			const SQ15x16 limitedRatio = (ratio < -2) ? SQ15x16(-2) : (ratio > 2) ? SQ15x16(2) : ratio;
+
+			const SQ15x16 screenX = (static_cast<uint8_t>(renderer.width() / 2) + (limitedRatio * static_cast<uint8_t>(renderer.width() / 2)));
+
+			leftmost = (screenX < leftmost) ? screenX : leftmost;
+			rightmost = (screenX > rightmost) ? screenX : rightmost;
+		}
+
+		if(!anyInFront || !anyRightOfLeftEdge || !anyLeftOfRightEdge)
+			return false;
+
+		if(!allInFront)
+			return true;
+
+		// Boxes entirely behind closed columns are hidden
+		const uint8_t startColumn = (leftmost > 0) ? static_cast<uint8_t>(leftmost) : 0;
+		const uint8_t endColumn = (rightmost < (renderer.width() - 1)) ? (static_cast<uint8_t>(rightmost) + 1) : renderer.width();
+
+		return context.occlusion.isAnyOpen(startColumn, endColumn);
+	}
+
+	// Rejects walls that can't be seen before anything about them is projected,
+	// counting them by the first test they fail.
+	// The tests only need the camera space positions of the wall's ends.
+	template<typename WallPolicy>
+	static bool isWallCulled(Context<WallPolicy> & context, const Point2SQ15x16 & start, const Point2SQ15x16 & end)
+	{
+		CullStatistics & statistics = context.statistics;
+		++statistics.walls;
+
+		if((start.x < Config::nearDepth()) && (end.x < Config::nearDepth()))
+		{
+			++statistics.behindNearPlane;
+			return true;
+		}
+
+		const SQ15x16 startSide = (start.y * Config::viewSlope());
+		const SQ15x16 endSide = (end.y * Config::viewSlope());
+
+		if(((startSide < -start.x) && (endSide < -end.x)) || ((startSide > start.x) && (endSide > end.x)))
+		{
+			++statistics.outsideView;
+			return true;
+		}
+
+		if(!isFacingCamera(start, end))
+		{
+			++statistics.backFacing;
+			return true;
+		}
+
+		return false;
+	}
+
+	// Clips a wall in camera space to the near plane,
+	// giving the fractions of the way along it from its start that remain.
+	// Returns false if none of it remains.
+	template<typename Clipping = typename Config::Clipping>
+	static traits::enable_if_t<traits::is_same<Clipping, NearPlaneClipping>::value, bool>
+		clipWall(const Point2SQ15x16 & start, const Point2SQ15x16 & end, SQ15x16 & startFraction, SQ15x16 & endFraction)
+	{
+		startFraction = 0;
+		endFraction = 1;
+
+		return clipToPlane((start.x - Config::nearDepth()), (end.x - Config::nearDepth()), startFraction, endFraction);
+	}
+
+	// Clips a wall in camera space to the near plane and the guard band, as above
+	template<typename Clipping = typename Config::Clipping>
+	static traits::enable_if_t<traits::is_same<Clipping, GuardBandClipping>::value, bool>
+		clipWall(const Point2SQ15x16 & start, const Point2SQ15x16 & end, SQ15x16 & startFraction, SQ15x16 & endFraction)
+	{
+		startFraction = 0;
+		endFraction = 1;
+
+		const SQ15x16 startSide = (start.y * Config::viewSlope());
+		const SQ15x16 endSide = (end.y * Config::viewSlope());
+
+		const SQ15x16 startGuard = (start.x * Config::guardBandScale());
+		const SQ15x16 endGuard = (end.x * Config::guardBandScale());
+
+		return
+			clipToPlane((start.x - Config::nearDepth()), (end.x - Config::nearDepth()), startFraction, endFraction) &&
+			clipToPlane((startGuard + startSide), (endGuard + endSide), startFraction, endFraction) &&
+			clipToPlane((startGuard - startSide), (endGuard - endSide), startFraction, endFraction);
+	}
+
+	// Narrows the part of a wall that remains to that on the inner side of a plane,
+	// given how far each end is from the plane, inner side positive
+	static bool clipToPlane(SQ15x16 startDistance, SQ15x16 endDistance, SQ15x16 & startFraction, SQ15x16 & endFraction)
+	{
+		if((startDistance < 0) && (endDistance < 0))
+			return false;
+
+		if((startDistance < 0) || (endDistance < 0))
+		{
+			// Always between 0 and 1, so it can't overflow
+			const SQ15x16 fraction = (startDistance / (startDistance - endDistance));
+
+			if(startDistance < 0)
+				startFraction = (fraction > startFraction) ? fraction : startFraction;
+			else
+				endFraction = (fraction < endFraction) ? fraction : endFraction;
+		}
+
+		return (startFraction < endFraction);
+	}
+
+	// Walls are seen from their left, so a wall faces the camera
+	// if the cross product of its ends in camera space is positive.
+	// The products can exceed SQ15x16's range, so they're compared at full precision.
+	static bool isFacingCamera(const Point2SQ15x16 & start, const Point2SQ15x16 & end)
+	{
+		return (getCrossProduct(start, end) > 0);
+	}
+
+	// Gets the cross product of two points at full precision, scaled by SQ15x16::scale squared
+	static SQ15x16::IntermediateType getCrossProduct(const Point2SQ15x16 & start, const Point2SQ15x16 & end)
+	{
+		using Intermediate = SQ15x16::IntermediateType;
+
+		const Intermediate startCross = (static_cast<Intermediate>(start.x.getInternal()) * end.y.getInternal());
+		const Intermediate endCross = (static_cast<Intermediate>(start.y.getInternal()) * end.x.getInternal());
+
+		return (startCross - endCross);
+	}
+
+	// Draws the columns of a wall between left and right that are still open.
+	// Returns false if none of the wall is visible,
+	// otherwise gets the columns that the wall covers.
+	template<typename WallPolicy>
+	static bool renderWall3D(Context<WallPolicy> & context, const Wall & wall, uint8_t left, uint8_t right, uint8_t & startColumn, uint8_t & endColumn)
+	{
+		ProjectedWall projected;
+
+		if(!projectWall3D(context, wall, left, right, projected))
+			return false;
+
+		startColumn = projected.startColumn;
+		endColumn = projected.endColumn;
+
+		const bool isPortal = (wall.neighbour != noSector);
+
+		auto & occlusion = context.occlusion;
+
+		if(Flats::isEnabled())
+			context.flats.setSector((wall.heights.ceiling / 2), (wall.heights.floor / 2), wall.light);
+
+		if(isPortal)
+		{
+			renderPortal3D(context, wall, projected);
+		}
+		else
+		{
+			const profiler::ScopedTimer timer { profiler::Stage::Rasterisation };
+			profiler::count(profiler::Counter::WallsDrawn);
+
+			forEachColumn(projected, [&context, &occlusion](WallColumn & column)
+			{
+				if(!occlusion.isOpen(column.x))
+					return;
+
+				column.clipTop = occlusion.getTop(column.x);
+				column.clipBottom = occlusion.getBottom(column.x);
+
+				// Flats go first, so that wall policies can draw over them
+				if(Flats::isEnabled())
+					drawFlats(context, column.x, column.top, column.bottom, column.clipTop, column.clipBottom);
+
+				context.wallPolicy.drawColumn(context.renderer, column);
+
+				if(context.depthBuffer != nullptr)
+					context.depthBuffer->set(column.x, column.halfHeight);
+
+				// Solid walls finish the column
+				occlusion.close(column.x);
+			});
+		}
+
+		if(Overlay::isEnabled() && !isPortal && projected.hasStartCorner)
+		{
+			// Identify which map coordinate you're looking at, just above the corner
+			const int16_t startTop = getRow(projected.top.row);
+
+			context.overlay.add(startColumn, (startTop - (2 * debugoverlay::lineHeight)), static_cast<int16_t>(wall.start.point.x));
+			context.overlay.add(startColumn, (startTop - debugoverlay::lineHeight), static_cast<int16_t>(wall.start.point.y));
+		}
+
+		return true;
+	}
+
+	// Narrows the columns of a portal to the part seen through it,
+	// between the lower of the two ceilings and the higher of the two floors.
+	// Where the sector across has a lower ceiling or a higher floor,
+	// the step between them is drawn as a wall from this sector's edge to the opening's.
+	// Steps don't close their columns, so they aren't recorded in the depth buffer.
+	template<typename WallPolicy>
+	static void renderPortal3D(Context<WallPolicy> & context, const Wall & wall, const ProjectedWall & projected)
+	{
+		auto & occlusion = context.occlusion;
+
+		const bool hasUpperStep = (wall.neighbourHeights.ceiling < wall.heights.ceiling);
+		const bool hasLowerStep = (wall.neighbourHeights.floor < wall.heights.floor);
+
+		const ProjectedEdge openingTop = projectEdge(projected, wall.neighbourHeights.ceiling);
+		const ProjectedEdge openingBottom = projectEdge(projected, -wall.neighbourHeights.floor);
+
+		SQ15x16 exactOpeningTop = openingTop.row;
+		SQ15x16 exactOpeningBottom = openingBottom.row;
+
+		int16_t previousOpeningTop = getRow(exactOpeningTop);
+		int16_t previousOpeningBottom = getRow(exactOpeningBottom);
+
+		forEachColumn(projected, [&](const WallColumn & column)
+		{
+			const int16_t rowOpeningTop = getRow(exactOpeningTop);
+			const int16_t rowOpeningBottom = getRow(exactOpeningBottom);
+
+			if(occlusion.isOpen(column.x))
+			{
+				const uint8_t clipTop = occlusion.getTop(column.x);
+				const uint8_t clipBottom = occlusion.getBottom(column.x);
+
+				if(Flats::isEnabled())
+					drawFlats(context, column.x, column.top, column.bottom, clipTop, clipBottom);
+
+				if(hasUpperStep)
+				{
+					WallColumn step = column;
+					step.bottom = rowOpeningTop;
+					step.previousBottom = previousOpeningTop;
+					step.clipTop = clipTop;
+					step.clipBottom = clipBottom;
+
+					context.wallPolicy.drawColumn(context.renderer, step);
+				}
+
+				if(hasLowerStep)
+				{
+					WallColumn step = column;
+					step.top = rowOpeningBottom;
+					step.previousTop = previousOpeningBottom;
+					step.exactTop = exactOpeningBottom;
+					step.clipTop = clipTop;
+					step.clipBottom = clipBottom;
+
+					context.wallPolicy.drawColumn(context.renderer, step);
+				}
+
+				// The rows of a step's edge belong to the step, so that what lies beyond can't fill over them
+				const int16_t top = hasUpperStep ? (rowOpeningTop + 1) : column.top;
+				const int16_t bottom = hasLowerStep ? rowOpeningBottom : (column.bottom + 1);
+
+				occlusion.narrow(column.x, top, bottom);
+			}
+
+			previousOpeningTop = rowOpeningTop;
+			previousOpeningBottom = rowOpeningBottom;
+			exactOpeningTop += openingTop.step;
+			exactOpeningBottom += openingBottom.step;
+		});
+	}
+
+	// Fills the ceiling above a wall's top row and the floor below its bottom row,
+	// within the rows of the column from clipTop (inclusive) to clipBottom (exclusive)
+	template<typename WallPolicy>
+	static void drawFlats(Context<WallPolicy> & context, uint8_t x, int16_t top, int16_t bottom, uint8_t clipTop, uint8_t clipBottom)
+	{
+		uint8_t * buffer = context.renderer.getBuffer();
+		const uint8_t * patterns = context.flats.getPatterns(x);
+
+		const uint8_t ceilingBottom = (top < clipTop) ? clipTop : (top > clipBottom) ? clipBottom : static_cast<uint8_t>(top);
+		const uint8_t floorTop = (bottom < clipTop) ? clipTop : (bottom >= clipBottom) ? clipBottom : static_cast<uint8_t>(bottom + 1);
+
+		framebuffer::fillColumnPages<Renderer::width()>(buffer, x, clipTop, ceilingBottom, patterns);
+		framebuffer::fillColumnPages<Renderer::width()>(buffer, x, floorTop, clipBottom, patterns);
+	}
+
+	// Culls, clips and projects a wall, narrowed to the columns between left and right.
+	// Returns false if none of the wall is visible in a column that is still open.
+	template<typename WallPolicy>
+	static bool projectWall3D(Context<WallPolicy> & context, const Wall & wall, uint8_t left, uint8_t right, ProjectedWall & projected)
+	{
+		const profiler::ScopedTimer timer { profiler::Stage::Projection };
+
+		Renderer & renderer = context.renderer;
+
+		const Point2SQ15x16 & startPoint = wall.start.transformed;
+		const Point2SQ15x16 & endPoint = wall.end.transformed;
+
+		if(isWallCulled(context, startPoint, endPoint))
+			return false;
+
+		SQ15x16 startFraction;
+		SQ15x16 endFraction;
+
+		if(!clipWall(startPoint, endPoint, startFraction, endFraction))
+			return false;
+
+		// Clipped ends are projected where the wall was clipped
+		const bool startClipped = (startFraction > 0);
+		const bool endClipped = (endFraction < 1);
+
+		const Projection startProjection = startClipped ? projectClipped(renderer, startPoint, endPoint, startFraction) : projectVertex(renderer, wall.start);
+		const Projection endProjection = endClipped ? projectClipped(renderer, startPoint, endPoint, endFraction) : projectVertex(renderer, wall.end);
+
+		// Don't render walls outside of the columns being rendered
+		if((startProjection.screenX >= right) || (endProjection.screenX <= left))
+			return false;
+
+		const bool startVisible = (startProjection.screenX > left);
+		const bool endVisible = (endProjection.screenX < right);
+
+		// Only the wall's real ends can be corners
+		const bool hasStartCorner = (wall.hasStartCorner && startVisible && !startClipped);
+		const bool hasEndCorner = (wall.hasEndCorner && endVisible && !endClipped);
+
+		const uint8_t startColumn = startVisible ? getColumn(startProjection.screenX) : left;
+		const uint8_t endColumn = endVisible ? getColumn(endProjection.screenX) : right;
+
+		if(startColumn >= endColumn)
+			return false;
+
+		// Don't render walls that are completely hidden
+		if(!context.occlusion.isAnyOpen(startColumn, endColumn))
+			return false;
+
+		const SQ15x16 inverseWidth = maths::reciprocal(endProjection.screenX - startProjection.screenX);
+		const SQ15x16 startOffset = (SQ15x16(startColumn) - startProjection.screenX);
+
+		projected = { startColumn, endColumn, hasStartCorner, hasEndCorner, 0, 0, 0, 0, {}, {}, 0, 0 };
+
+		// The wall's half height changes linearly across the screen
+		projected.heightStep = ((endProjection.halfHeight - startProjection.halfHeight) * inverseWidth);
+		projected.halfHeight = (startProjection.halfHeight + (startOffset * projected.heightStep));
+
+		// So do its edges, which are scaled from it
+		projected.top = projectEdge(projected, wall.heights.ceiling);
+		projected.bottom = projectEdge(projected, -wall.heights.floor);
+
+		// Brightness is the sector's light over the depth, and the half height is proportional to the reciprocal of the depth,
+		// so the brightness is scaled from it too. Portals are lit for the steps drawn at them.
+		if(WallPolicy::isLit())
+		{
+			const SQ15x16 lightScale = (SQ15x16(wall.light) * (SQ15x16(2) / projectionScale()));
+
+			projected.brightness = (lightScale * projected.halfHeight);
+			projected.brightnessStep = (lightScale * projected.heightStep);
+		}
+
+		// As does the distance along the wall multiplied by the half height
+		if(WallPolicy::isTextured() && (wall.neighbour == noSector))
+		{
+			// Clipped ends move along the wall
+			const SQ15x16 startU = startClipped ? maths::lerp(wall.startU, wall.endU, startFraction) : wall.startU;
+			const SQ15x16 endU = endClipped ? maths::lerp(wall.startU, wall.endU, endFraction) : wall.endU;
+
+			const SQ15x16 startProjectedU = (startU * startProjection.halfHeight);
+			const SQ15x16 endProjectedU = (endU * endProjection.halfHeight);
+
+			projected.projectedUStep = ((endProjectedU - startProjectedU) * inverseWidth);
+			projected.projectedU = (startProjectedU + (startOffset * projected.projectedUStep));
+		}
+
+		return true;
+	}
+
+	// Projects a horizontal edge of a wall, the given number of half units above the eye.
+	// Scaling the half height costs two multiplies per wall, rather than a divide per column.
+	static ProjectedEdge projectEdge(const ProjectedWall & wall, SQ15x16 height)
+	{
+		const SQ15x16 centreY = static_cast<uint8_t>(Renderer::height() / 2);
+
+		return { (centreY - (height * wall.halfHeight)), -(height * wall.heightStep) };
+	}
+
+	// Steps a projected wall across its columns, giving each to 'visit' with its clip rows unset.
+	// Every way of drawing a wall steps it the same way, so they all draw the same rows.
+	template<typename Visit>
+	static void forEachColumn(const ProjectedWall & wall, Visit visit)
+	{
+		SQ15x16 halfHeight = wall.halfHeight;
+		SQ15x16 projectedU = wall.projectedU;
+		SQ15x16 exactTop = wall.top.row;
+		SQ15x16 exactBottom = wall.bottom.row;
+		SQ15x16 brightness = wall.brightness;
+
+		int16_t previousTop = getRow(exactTop);
+		int16_t previousBottom = getRow(exactBottom);
+
+		for(uint8_t x = wall.startColumn; x < wall.endColumn; ++x, halfHeight += wall.heightStep, projectedU += wall.projectedUStep, exactTop += wall.top.step, exactBottom += wall.bottom.step, brightness += wall.brightnessStep)
+		{
+			const int16_t top = getRow(exactTop);
+			const int16_t bottom = getRow(exactBottom);
+
+			WallColumn column
+			{
+				x,
+				top, bottom,
+				previousTop, previousBottom,
+				0, 0,
+				// Left
+				(wall.hasStartCorner && (x == wall.startColumn)),
+				// Right, unless the next wall's left edge is drawn in its place
+				(wall.hasEndCorner && (x == (wall.endColumn - 1))),
+				halfHeight,
+				exactTop,
+				projectedU,
+				(brightness <= 0) ? static_cast<uint8_t>(0) : (brightness < dither::levelCount) ? static_cast<uint8_t>(brightness) : dither::levelCount,
+			};
+
+			visit(column);
+
+			previousTop = top;
+			previousBottom = bottom;
+		}
+	}
+
+	// Each vertex is read and transformed once, as in renderSector3D.
+	// Edges shared by two sectors are drawn by the sector with the lower id.
+	template<typename LinePolicy>
+	static void renderSector2D(Renderer & renderer, const Camera & camera, const Sector & sector, SectorId sectorId, const Point2SQ15x16 & screenCentre, const LinePolicy & linePolicy)
+	{
+		const uint8_t pointCount = sector.getPointCount();
+
+		if(pointCount == 0)
+			return;
+
+		const Point2I16 first = static_cast<Point2I16>(screenCentre + (sector.getPoint(0) - camera.position));
+		Point2I16 previous = first;
+
+		for(uint8_t index = 1; index < pointCount; ++index)
+		{
+			const Point2I16 current = static_cast<Point2I16>(screenCentre + (sector.getPoint(index) - camera.position));
+
+			if(sector.getNeighbour(index - 1) > sectorId)
+				linePolicy.drawLine(renderer, previous.x, previous.y, current.x, current.y);
+
+			previous = current;
+		}
+
+		if(sector.getNeighbour(pointCount - 1) > sectorId)
+			linePolicy.drawLine(renderer, previous.x, previous.y, first.x, first.y);
+	}
 };
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "FixedPoints.h"
+#include "WallPolicies.h"
+#include "LinePolicies.h"
+
+// SectorRenderer's compile time settings.
+// A config is a type with the same members as DefaultSectorRendererConfig,
+// most easily made by deriving from it and hiding the members to change.
+// Settings are types and constexpr functions, so they fold into the renderer,
+// and features that are turned off compile to nothing rather than being tested every frame.
+
+/// Clips walls to the near plane only.
+/// Saves two planes per wall, but walls running off to the side are projected beyond the screen,
+/// and the distance between their ends on screen must fit in an SQ15x16.
+/// With the default field of view, that holds while no wall is more than 127 units to the side of the camera.
+struct NearPlaneClipping {};
+
+/// Clips walls to the near plane and to a guard band around the view,
+/// which bounds the projected ends of every wall.
+struct GuardBandClipping {};
+
+struct DefaultSectorRendererConfig
+{
+	/// How render3D and render3DBsp draw walls when they aren't given a wall policy.
+	using WallPolicy = WireframeWallPolicy<>;
+
+	/// How render2D draws lines when it isn't given a line policy.
+	using LinePolicy = RendererLinePolicy;
+
+	/// NearPlaneClipping or GuardBandClipping.
+	using Clipping = GuardBandClipping;
+
+	/// Walls are clipped to the plane at this depth,
+	/// which keeps the reciprocal of the depth within range.
+	static constexpr SQ15x16 nearDepth()
+	{
+		return 1;
+	}
+
+	/// The field of view.
+	/// The view is bounded by the lines through the camera and the screen's edges,
+	/// which in camera space are (y * viewSlope = x) and its mirror,
+	/// so the view narrows as the slope grows. A slope of 2 is about 53 degrees.
+	/// Walls keep their proportions whatever the slope.
+	static constexpr uint8_t viewSlope()
+	{
+		return 2;
+	}
+
+	/// With GuardBandClipping, the width of the guard band in multiples of the width of the view.
+	static constexpr uint8_t guardBandScale()
+	{
+		return 2;
+	}
+
+	/// Bounds the recursion, and so the stack, when looking through many portals.
+	static constexpr uint8_t maxPortalDepth()
+	{
+		return 6;
+	}
+
+	/// Whether render3D and render3DBsp draw a debug overlay over the scene,
+	/// giving the camera's sector and the map coordinates of the corners they outline.
+	/// Only in builds without NDEBUG, so release builds compile it away.
+	static constexpr bool isDebugOverlayDrawn()
+	{
+#if defined(NDEBUG)
+		return false;
+#else
+		return true;
+#endif
+	}
+
+	/// Whether render3D and render3DBsp fill the floor and ceiling, the flats, with ordered dithering.
+	/// Each sector's flats are filled in the columns seen through it, above and below its walls,
+	/// and are lit by its light (see Sector::getLight).
+	static constexpr bool areFlatsDrawn()
+	{
+		return false;
+	}
+
+	/// The size of SectorRenderer::TransformCache, in points.
+	/// Each takes 10 bytes. Sized to a level's point count (see LevelCompiler),
+	/// walking through it without turning needs no rotations at all.
+	/// Smaller caches share slots between points, which replace each other.
+	static constexpr uint16_t vertexCacheCapacity()
+	{
+		return 16;
+	}
+
+	/// The most numbers the debug overlay keeps in a frame.
+	static constexpr uint8_t debugOverlayCapacity()
+	{
+		return 12;
+	}
+};
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Geometry.h"
+#include "Camera.h"
+#include "Level.h"
+#include "EntityPool.h"
+#include "Texture.h"
+#include "DepthBuffer.h"
+#include "SectorRenderer.h"
+#include "SectorRendererConfig.h"
+#include "Profiler.h"
+#include "Maths.h"
+
+// Draws the entities of an EntityPool as sprites that always face the camera, over a scene drawn by SectorRenderer.
+// Sprites are projected like walls, with the same config, so they stand in the world the walls are in:
+// a sprite is as tall as a wall, stands on the floor of the sector it is in, and its texels are square.
+template<typename Renderer, typename Config = DefaultSectorRendererConfig>
+struct SpriteRenderer
+{
+private:
+	// A sprite that passed culling, waiting to be sorted and drawn
+	struct VisibleSprite
+	{
+		// The position relative to the camera, with depth being along its forward vector
+		SQ15x16 depth;
+		SQ15x16 side;
+
+		// Where the entity is, for finding the floor it stands on
+		Point2SQ15x16 position;
+
+		// Half the sprite's width in the world, a wall being one unit tall
+		SQ15x16 halfWidth;
+
+		const MaskedSprite * sprite;
+	};
+
+	// Sprites beyond this many in view in one frame are dropped, furthest first.
+	// Each takes 22 bytes of stack on the Arduboy, so the list takes 176.
+	static constexpr uint8_t maxVisibleSprites()
+	{
+		return 8;
+	}
+
+public:
+	/// Draws entities over the scene, furthest first so that nearer sprites cover them.
+	/// Each column of a sprite is only drawn if it is nearer than the wall in that column,
+	/// as recorded in the depth buffer by SectorRenderer.
+	/// Sprites nearer than the near plane, outside the view or wholly behind walls
+	/// are rejected before any of their columns are scaled.
+	/// Each entity is drawn with the sprite its type indexes.
+	/// Entities don't keep track of their sector, so it is looked up for those that pass culling.
+	/// Those outside of every sector stand at a height of 0.
+	/// On the Arduboy the pass takes about 300 bytes of stack with the depth buffer,
+	/// which is 128 bytes, and the list of visible sprites.
+	template<uint16_t Capacity>
+	static void render(Renderer & renderer, const Camera & camera, const Level & level, const EntityPool<Capacity> & entities, const MaskedSprite * sprites, const DepthBuffer<Renderer::width()> & depthBuffer)
+	{
+		VisibleSprite visible[maxVisibleSprites()];
+		uint8_t visibleCount = 0;
+
+		const Point2SQ15x16 * positions = entities.getPositions();
+		const uint8_t * types = entities.getTypes();
+
+		// Entities of a type tend to come together, so a sprite's width is only worked out when it changes
+		const MaskedSprite * previousSprite = nullptr;
+		SQ15x16 halfWidth = 0;
+
+		for(uint16_t index = 0; index < entities.getCount(); ++index)
+		{
+			const MaskedSprite & sprite = sprites[types[index]];
+
+			if(&sprite != previousSprite)
+			{
+				previousSprite = &sprite;
+				halfWidth = getHalfWidth(sprite);
+			}
+
+			addVisible(camera, positions[index], sprite, halfWidth, visible, visibleCount);
+		}
+
+		for(uint8_t index = 0; index < visibleCount; ++index)
+			drawSprite(renderer, camera, level, visible[index], depthBuffer);
+	}
+
+private:
+	// Gets half a sprite's width in the world, a wall being one unit tall.
+	// Divides the internal value by the height directly, which is exact and cheaper than dividing SQ15x16s.
+	static SQ15x16 getHalfWidth(const MaskedSprite & sprite)
+	{
+		const int32_t halfWidth = (static_cast<int32_t>(sprite.image.getWidth()) << (SQ15x16::fractionSize - 1));
+
+		return SQ15x16::fromInternal(halfWidth / sprite.image.getHeight());
+	}
+
+	// Transforms an entity into camera space and keeps it if it can be seen,
+	// keeping the visible sprites sorted furthest first
+	static void addVisible(const Camera & camera, const Point2SQ15x16 & position, const MaskedSprite & sprite, SQ15x16 halfWidth, VisibleSprite (&visible)[maxVisibleSprites()], uint8_t & visibleCount)
+	{
+		const profiler::ScopedTimer timer { profiler::Stage::Transform };
+
+		const Vector2SQ15x16 offset = (position - camera.position);
+		const SQ15x16 depth = dotProduct(offset, camera.getForward());
+
+		if(depth < Config::nearDepth())
+			return;
+
+		const SQ15x16 side = dotProduct(offset, camera.getRight());
+
+		// Outside the view if entirely beyond its left or right edge
+		if((((side + halfWidth) * Config::viewSlope()) < -depth) || (((side - halfWidth) * Config::viewSlope()) > depth))
+			return;
+
+		// When full, the furthest sprite makes way, if this one is nearer
+		if(visibleCount == maxVisibleSprites())
+		{
+			if(depth >= visible[0].depth)
+				return;
+
+			for(uint8_t index = 1; index < visibleCount; ++index)
+				visible[index - 1] = visible[index];
+
+			--visibleCount;
+		}
+
+		// Insertion keeps the list sorted furthest first
+		uint8_t index = visibleCount;
+
+		for(; (index > 0) && (visible[index - 1].depth < depth); --index)
+			visible[index] = visible[index - 1];
+
+		visible[index] = { depth, side, position, halfWidth, &sprite };
+		++visibleCount;
+	}
+
+	// Gets the first column or row at or after a screen position, which must be on screen or beyond its far edge
+	static uint8_t roundUp(SQ15x16 x)
+	{
+		return static_cast<uint8_t>((x.getInternal() + (SQ15x16::scale - 1)) >> SQ15x16::fractionSize);
+	}
+
+	static void drawSprite(Renderer & renderer, const Camera & camera, const Level & level, const VisibleSprite & visible, const DepthBuffer<Renderer::width()> & depthBuffer)
+	{
+		const MaskedSprite & sprite = *visible.sprite;
+
+		uint8_t startColumn;
+		uint8_t endColumn;
+		SQ15x16 left;
+		SQ15x16 halfHeight;
+
+		{
+			const profiler::ScopedTimer timer { profiler::Stage::Projection };
+
+			const SQ15x16 inverseDepth = maths::reciprocal(visible.depth);
+
+			const SQ15x16 scale = SectorRenderer<Renderer, Config>::projectionScale();
+			const SQ15x16 screenX = (static_cast<uint8_t>(Renderer::width() / 2) + (visible.side * (scale * inverseDepth)));
+
+			halfHeight = ((scale / 2) * inverseDepth);
+
+			// A wall is twice its half height on screen
+			const SQ15x16 halfWidth = ((halfHeight * 2) * visible.halfWidth);
+
+			left = (screenX - halfWidth);
+			const SQ15x16 right = (screenX + halfWidth);
+
+			if((right <= 0) || (left >= Renderer::width()))
+				return;
+
+			startColumn = (left > 0) ? roundUp(left) : 0;
+			endColumn = (right < Renderer::width()) ? roundUp(right) : Renderer::width();
+
+			if(!isAnyVisible(depthBuffer, startColumn, endColumn, halfHeight))
+				return;
+		}
+
+		const profiler::ScopedTimer timer { profiler::Stage::Rasterisation };
+
+		// The eye's height above the floor, in half units, as the walls are projected
+		const SectorId sector = level.findSector(visible.position, camera.sector);
+		const SQ15x16 floor = (sector != noSector) ? SQ15x16(level.getSector(sector).getFloorHeight()) : SQ15x16(0);
+		const SQ15x16 eyeHeight = ((camera.height - floor) * 2);
+
+		const SQ15x16 centreY = static_cast<uint8_t>(Renderer::height() / 2);
+		const SQ15x16 bottom = (centreY + (eyeHeight * halfHeight));
+		const SQ15x16 top = (bottom - (halfHeight * 2));
+
+		const uint8_t clipTop = (top > 0) ? roundUp(top) : 0;
+		const uint8_t clipBottom = (bottom < Renderer::height()) ? roundUp(bottom) : Renderer::height();
+
+		if(clipTop >= clipBottom)
+			return;
+
+		// Texels are square, so one step serves both directions
+		const uint8_t textureWidth = sprite.image.getWidth();
+		const SQ15x16 step = (SQ15x16(sprite.image.getHeight()) * maths::reciprocal(halfHeight * 2));
+
+		const SQ15x16 firstTexel = ((SQ15x16(clipTop) - top) * step);
+		SQ15x16 u = ((SQ15x16(startColumn) - left) * step);
+
+		for(uint8_t x = startColumn; x < endColumn; ++x, u += step)
+		{
+			if(depthBuffer.isHidden(x, halfHeight))
+				continue;
+
+			const uint8_t textureX = (u < textureWidth) ? static_cast<uint8_t>(u) : (textureWidth - 1);
+
+			drawColumn(renderer.getBuffer(), sprite, x, textureX, firstTexel, step, clipTop, clipBottom);
+		}
+	}
+
+	static bool isAnyVisible(const DepthBuffer<Renderer::width()> & depthBuffer, uint8_t startColumn, uint8_t endColumn, SQ15x16 halfHeight)
+	{
+		for(uint8_t x = startColumn; x < endColumn; ++x)
+			if(!depthBuffer.isHidden(x, halfHeight))
+				return true;
+
+		return false;
+	}
+
+	// Draws the rows from clipTop (inclusive) to clipBottom (exclusive) of a column of a sprite,
+	// starting from the given texel and stepping down the texture.
+	// Each page of the frame buffer is written once, masked,
+	// and the sprite's bytes are only read again when the texel moves to another page.
+	static void drawColumn(uint8_t * buffer, const MaskedSprite & sprite, uint8_t x, uint8_t textureX, SQ15x16 firstTexel, SQ15x16 step, uint8_t clipTop, uint8_t clipBottom)
+	{
+		profiler::count(profiler::Counter::PixelsWritten, (clipBottom - clipTop));
+
+		const uint8_t lastTexel = (sprite.image.getHeight() - 1);
+
+		uint8_t * pointer = &buffer[((clipTop / 8) * Renderer::width()) + x];
+
+		uint8_t texturePage = 0xFF;
+		uint8_t imageByte = 0;
+		uint8_t maskByte = 0;
+
+		uint8_t bits = 0;
+		uint8_t mask = 0;
+
+		SQ15x16 texel = firstTexel;
+
+		for(uint8_t y = clipTop; y < clipBottom; ++y, texel += step)
+		{
+			const uint8_t textureY = (texel < lastTexel) ? static_cast<uint8_t>(texel) : lastTexel;
+
+			if((textureY / 8) != texturePage)
+			{
+				texturePage = (textureY / 8);
+				imageByte = sprite.image.getByte(textureX, texturePage);
+				maskByte = sprite.mask.getByte(textureX, texturePage);
+			}
+
+			const uint8_t textureBit = (1 << (textureY % 8));
+
+			if((maskByte & textureBit) != 0)
+			{
+				const uint8_t rowBit = (1 << (y % 8));
+
+				mask |= rowBit;
+
+				if((imageByte & textureBit) != 0)
+					bits |= rowBit;
+			}
+
+			// Write at the end of each page
+			if(((y % 8) == 7) || ((y + 1) == clipBottom))
+			{
+				*pointer = ((*pointer & ~mask) | bits);
+				pointer += Renderer::width();
+
+				bits = 0;
+				mask = 0;
+			}
+		}
+	}
+};
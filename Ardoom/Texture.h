@@ -1,90 +1,118 @@
-#pragma once
-
-#include <stdint.h>
-#include <avr/pgmspace.h>
-
-struct Texture
-{
-private:
-	const uint8_t * texture;
-	uint8_t width;
-	uint8_t height;
-
-public:
-	Texture() = default;
-
-	constexpr Texture(const uint8_t * texture, uint8_t width, uint8_t height) :
-		texture{texture}, width{width}, height{height}
-	{
-	}
-
-	constexpr uint8_t getWidth() const
-	{
-		return this->width;
-	}
-
-	constexpr uint8_t getHeight() const
-	{
-		return this->height;
-	}
-
-	uint8_t getPixel(uint8_t x, uint8_t y) const
-	{
-		const uint8_t row = (y / 8);
-		const size_t index = ((row * this->getWidth()) + x);
-
-		const uint8_t bitShift = (y % 8);
-		const uint8_t bitMask = (1 << bitShift);
-
-		return ((this->texture[index] & bitMask) >> bitShift);
-	}
-
-	uint8_t setPixel(uint8_t x, uint8_t y, uint8_t value)
-	{
-		const uint8_t row = (y / 8);
-		const size_t index = ((row * this->getWidth()) + x);
-
-		const uint8_t bitShift = (y % 8);
-		const uint8_t bitMask = (1 << bitShift);
-
-		if(value != 0)
-			this->texture[index] |= bitMask;
-		else
-			this->texture[index] &= ~bitMask;
-	}
-};
-
-struct ProgmemTexture
-{
-private:
-	const uint8_t * texture;
-
-public:
-	Texture() = default;
-
-	constexpr Texture(const uint8_t * texture) :
-		texture{texture}
-	{
-	}
-
-	uint8_t getWidth() const
-	{
-		return pgm_read_byte(&texture[0]);
-	}
-
-	uint8_t getHeight() const
-	{
-		return pgm_read_byte(&texture[1]);
-	}
-
-	uint8_t getPixel(uint8_t x, uint8_t y) const
-	{
-		const uint8_t row = (y / 8);
-		const size_t index = ((row * this->getWidth()) + x);
-
-		const uint8_t bitShift = (y % 8);
-		const uint8_t bitMask = (1 << bitShift);
-
-		return ((pgm_read_byte(&this->texture[index]) & bitMask) >> bitShift);
-	}
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+// Textures share the frame buffer's layout:
+// each byte is a column of 8 rows, the least significant bit at the top,
+// and each run of 'width' bytes is a page of 8 rows.
+
+struct Texture
+{
+private:
+	uint8_t * texture;
+	uint8_t width;
+	uint8_t height;
+
+public:
+	Texture() = default;
+
+	constexpr Texture(uint8_t * texture, uint8_t width, uint8_t height) :
+		texture{texture}, width{width}, height{height}
+	{
+	}
+
+	constexpr uint8_t getWidth() const
+	{
+		return this->width;
+	}
+
+	constexpr uint8_t getHeight() const
+	{
+		return this->height;
+	}
+
+	/// Gets the 8 rows of a column that make up one page.
+	uint8_t getByte(uint8_t x, uint8_t page) const
+	{
+		return this->texture[(page * this->getWidth()) + x];
+	}
+
+	uint8_t getPixel(uint8_t x, uint8_t y) const
+	{
+		const uint8_t row = (y / 8);
+		const size_t index = ((row * this->getWidth()) + x);
+
+		const uint8_t bitShift = (y % 8);
+		const uint8_t bitMask = (1 << bitShift);
+
+		return ((this->texture[index] & bitMask) >> bitShift);
+	}
+
+	void setPixel(uint8_t x, uint8_t y, uint8_t value)
+	{
+		const uint8_t row = (y / 8);
+		const size_t index = ((row * this->getWidth()) + x);
+
+		const uint8_t bitShift = (y % 8);
+		const uint8_t bitMask = (1 << bitShift);
+
+		if(value != 0)
+			this->texture[index] |= bitMask;
+		else
+			this->texture[index] &= ~bitMask;
+	}
+};
+
+/// A texture in progmem, prefixed by its width and height.
+struct ProgmemTexture
+{
+private:
+	static constexpr size_t headerSize = 2;
+
+	const uint8_t * texture;
+
+public:
+	ProgmemTexture() = default;
+
+	constexpr ProgmemTexture(const uint8_t * texture) :
+		texture{texture}
+	{
+	}
+
+	uint8_t getWidth() const
+	{
+		return pgm_read_byte(&texture[0]);
+	}
+
+	uint8_t getHeight() const
+	{
+		return pgm_read_byte(&texture[1]);
+	}
+
+	/// Gets the 8 rows of a column that make up one page.
+	uint8_t getByte(uint8_t x, uint8_t page) const
+	{
+		return pgm_read_byte(&this->texture[headerSize + (page * this->getWidth()) + x]);
+	}
+
+	uint8_t getPixel(uint8_t x, uint8_t y) const
+	{
+		const uint8_t row = (y / 8);
+		const size_t index = (headerSize + (row * this->getWidth()) + x);
+
+		const uint8_t bitShift = (y % 8);
+		const uint8_t bitMask = (1 << bitShift);
+
+		return ((pgm_read_byte(&this->texture[index]) & bitMask) >> bitShift);
+	}
+};
+
+/// A 1-bit image with a mask, both ProgmemTextures of the same size.
+/// Where the mask is set the image is drawn, white where it is set and black where it isn't.
+/// Elsewhere whatever is behind shows through.
+struct MaskedSprite
+{
+	ProgmemTexture image;
+	ProgmemTexture mask;
 };
\ No newline at end of file
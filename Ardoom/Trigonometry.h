@@ -0,0 +1,64 @@
+#pragma once
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For PROGMEM, pgm_read_word
+#include <avr/pgmspace.h>
+
+#include "BinaryAngle.h"
+#include "FixedPoints.h"
+
+namespace maths
+{
+	namespace details
+	{
+		// The first quarter of a sine wave in 64 steps, inclusive of both ends.
+		// Scaled so that 32768 represents 1.
+		const uint16_t quarterSineTable[65] PROGMEM
+		{
+			0, 804, 1608, 2411, 3212, 4011, 4808, 5602,
+			6393, 7180, 7962, 8740, 9512, 10279, 11039, 11793,
+			12540, 13279, 14010, 14733, 15447, 16151, 16846, 17531,
+			18205, 18868, 19520, 20160, 20788, 21403, 22006, 22595,
+			23170, 23732, 24279, 24812, 25330, 25833, 26320, 26791,
+			27246, 27684, 28106, 28511, 28899, 29269, 29622, 29957,
+			30274, 30572, 30853, 31114, 31357, 31581, 31786, 31972,
+			32138, 32286, 32413, 32522, 32610, 32679, 32729, 32758,
+			32768,
+		};
+	}
+
+	//
+	// sin
+	//
+
+	/// Gets the sine of a binary angle.
+	/// Resolution is 256 steps per turn, at the cost of one table read.
+	template<typename Type>
+	SQ15x16 sin(BinaryAngle<Type> angle)
+	{
+		const uint8_t index = angle.getIndex();
+
+		// The second and fourth quarters read the table backwards
+		const uint8_t offset = (index & 0x3F);
+		const uint8_t tableIndex = ((index & 0x40) != 0) ? (64 - offset) : offset;
+
+		const uint16_t value = pgm_read_word(&details::quarterSineTable[tableIndex]);
+		const SQ15x16 result = SQ15x16::fromInternal(static_cast<int32_t>(value) * 2);
+
+		// The second half of the wave is the first half negated
+		return ((index & 0x80) != 0) ? -result : result;
+	}
+
+	//
+	// cos
+	//
+
+	/// Gets the cosine of a binary angle.
+	template<typename Type>
+	SQ15x16 cos(BinaryAngle<Type> angle)
+	{
+		return sin(angle + BinaryAngle<Type>::quarterTurn());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Geometry.h"
+#include "Camera.h"
+#include "BinaryAngle.h"
+#include "CommonTypes.h"
+
+/// Keeps the points of recently drawn sectors in the camera's basis (see Camera::toBasis) from frame to frame.
+/// Moving the camera without turning it leaves them all valid,
+/// so SectorRenderer only has to subtract the camera's position from each, rather than rotating it again.
+/// Turning the camera forgets them all.
+/// Points are identified by their PointId (see Sector::getFirstPoint), and each has one slot it can go in.
+/// With a slot for each of the level's points (see LevelCompiler's PointCount constants), none are shared.
+/// Otherwise a point that finds its slot taken replaces what is there.
+/// The cache doesn't know which level its points came from, so it must be reset when the level changes.
+template<uint16_t Capacity>
+class VertexCache
+{
+private:
+	struct Entry
+	{
+		// Which point this is, or noPoint if the slot is empty
+		PointId point;
+
+		Point2SQ15x16 rotated;
+	};
+
+	Entry entries[Capacity];
+
+	// The camera's angle when the points were rotated
+	BinaryAngleU16 angle { 0 };
+
+public:
+	VertexCache()
+	{
+		this->reset();
+	}
+
+	/// Forgets every point.
+	void reset()
+	{
+		for(uint16_t slot = 0; slot < Capacity; ++slot)
+			this->entries[slot].point = noPoint;
+	}
+
+	/// Gets ready to draw a frame from the camera, forgetting every point if it has turned.
+	void update(const Camera & camera)
+	{
+		if(camera.getAngle() == this->angle)
+			return;
+
+		this->angle = camera.getAngle();
+		this->reset();
+	}
+
+	/// Gets a point of the level in the camera's basis, rotating it if it isn't in the cache.
+	Point2SQ15x16 getRotated(const Camera & camera, PointId point, const Point2SQ15x16 & position)
+	{
+		Entry & entry = this->entries[point % Capacity];
+
+		if(entry.point != point)
+			entry = { point, camera.toBasis(position) };
+
+		return entry.rotated;
+	}
+};
\ No newline at end of file
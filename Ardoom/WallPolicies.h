@@ -0,0 +1,329 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "FixedPoints.h"
+#include "Dither.h"
+#include "FrameBuffer.h"
+#include "LinePolicies.h"
+#include "PolygonRenderer.h"
+
+/// The part of a wall that falls within one screen column.
+struct WallColumn
+{
+	uint8_t x;
+
+	// The rows of the wall's top and bottom edges
+	int16_t top;
+	int16_t bottom;
+
+	// The rows of the edges in the previous column, used to join steep edges
+	int16_t previousTop;
+	int16_t previousBottom;
+
+	// The rows still visible in the column, from clipTop (inclusive) to clipBottom (exclusive)
+	uint8_t clipTop;
+	uint8_t clipBottom;
+
+	// Whether the column holds a visible end of the wall
+	bool isLeftEnd;
+	bool isRightEnd;
+
+	// Half the height of one unit of the wall on screen, which shrinks with its depth
+	SQ15x16 halfHeight;
+
+	// The screen position of the wall's top edge, before it is rounded and clipped
+	SQ15x16 exactTop;
+
+	// The distance along the wall multiplied by halfHeight.
+	// Unlike the distance itself, this changes linearly across the screen.
+	// Only calculated for textured walls.
+	SQ15x16 projectedU;
+
+	// How bright the wall is in this column, from 0 to dither::levelCount,
+	// falling in proportion to its depth from the light of its sector.
+	// Only calculated for lit walls.
+	uint8_t brightness;
+
+	/// Clips the rows from 'from' to 'to' inclusive to the visible rows.
+	/// Returns false if none of them are visible.
+	bool clip(int16_t from, int16_t to, uint8_t & top, uint8_t & bottom) const
+	{
+		if((to < this->clipTop) || (from >= this->clipBottom) || (from > to))
+			return false;
+
+		top = (from > this->clipTop) ? static_cast<uint8_t>(from) : this->clipTop;
+		bottom = (to < this->clipBottom) ? static_cast<uint8_t>(to + 1) : this->clipBottom;
+		return true;
+	}
+
+	/// Gets the rows of an edge in this column, joined to its row in the previous column
+	/// so that steep edges have no gaps.
+	static void getEdgeRows(int16_t previous, int16_t current, int16_t & from, int16_t & to)
+	{
+		if(previous < current)
+		{
+			from = (previous + 1);
+			to = current;
+		}
+		else if(previous > current)
+		{
+			from = current;
+			to = (previous - 1);
+		}
+		else
+		{
+			from = current;
+			to = current;
+		}
+	}
+};
+
+/// Draws the outlines of walls with a line policy.
+template<typename LinePolicy = RendererLinePolicy>
+struct WireframeWallPolicy
+{
+private:
+	LinePolicy linePolicy;
+
+public:
+	WireframeWallPolicy(const LinePolicy & linePolicy = LinePolicy()) :
+		linePolicy{linePolicy}
+	{
+	}
+
+	// Whether the renderer needs to calculate projectedU
+	static constexpr bool isTextured()
+	{
+		return false;
+	}
+
+	// Whether the renderer needs to calculate brightness
+	static constexpr bool isLit()
+	{
+		return false;
+	}
+
+	template<typename Renderer>
+	void drawColumn(Renderer & renderer, const WallColumn & column) const
+	{
+		// Top
+		this->drawEdge(renderer, column, column.previousTop, column.top);
+
+		// Bottom
+		this->drawEdge(renderer, column, column.previousBottom, column.bottom);
+
+		// Left and right
+		if(column.isLeftEnd || column.isRightEnd)
+			this->drawSpan(renderer, column, column.top, column.bottom);
+	}
+
+private:
+	template<typename Renderer>
+	void drawSpan(Renderer & renderer, const WallColumn & column, int16_t from, int16_t to) const
+	{
+		uint8_t top;
+		uint8_t bottom;
+
+		if(column.clip(from, to, top, bottom))
+			this->linePolicy.drawVerticalLine(renderer, column.x, top, bottom);
+	}
+
+	template<typename Renderer>
+	void drawEdge(Renderer & renderer, const WallColumn & column, int16_t previous, int16_t current) const
+	{
+		int16_t from;
+		int16_t to;
+
+		WallColumn::getEdgeRows(previous, current, from, to);
+		this->drawSpan(renderer, column, from, to);
+	}
+};
+
+/// Fills walls solidly, leaving a dark column at each end to separate neighbouring walls.
+/// Writes straight to the frame buffer a page at a time.
+struct SolidWallPolicy
+{
+	// Whether the renderer needs to calculate projectedU
+	static constexpr bool isTextured()
+	{
+		return false;
+	}
+
+	// Whether the renderer needs to calculate brightness
+	static constexpr bool isLit()
+	{
+		return false;
+	}
+
+	template<typename Renderer>
+	void drawColumn(Renderer & renderer, const WallColumn & column) const
+	{
+		uint8_t top;
+		uint8_t bottom;
+
+		if(!column.clip(column.top, column.bottom, top, bottom))
+			return;
+
+		const uint8_t pattern = (column.isLeftEnd || column.isRightEnd) ? 0x00 : 0xFF;
+
+		framebuffer::fillColumn<Renderer::width()>(renderer.getBuffer(), column.x, top, bottom, pattern);
+	}
+};
+
+/// Fills walls with a checkerboard, outlined solidly.
+/// Writes straight to the frame buffer a page at a time.
+struct DitheredWallPolicy
+{
+	// Whether the renderer needs to calculate projectedU
+	static constexpr bool isTextured()
+	{
+		return false;
+	}
+
+	// Whether the renderer needs to calculate brightness
+	static constexpr bool isLit()
+	{
+		return false;
+	}
+
+	template<typename Renderer>
+	void drawColumn(Renderer & renderer, const WallColumn & column) const
+	{
+		uint8_t top;
+		uint8_t bottom;
+
+		if(!column.clip(column.top, column.bottom, top, bottom))
+			return;
+
+		uint8_t * buffer = renderer.getBuffer();
+
+		if(column.isLeftEnd || column.isRightEnd)
+		{
+			framebuffer::fillColumn<Renderer::width()>(buffer, column.x, top, bottom, 0xFF);
+			return;
+		}
+
+		const uint8_t pattern = ((column.x % 2) == 0) ? 0x55 : 0xAA;
+
+		framebuffer::fillColumn<Renderer::width()>(buffer, column.x, top, bottom, pattern);
+
+		// Top
+		fillEdge<Renderer::width()>(buffer, column, column.previousTop, column.top);
+
+		// Bottom
+		fillEdge<Renderer::width()>(buffer, column, column.previousBottom, column.bottom);
+	}
+
+	/// Fills the rows of an edge of a column solidly, joined to the previous column.
+	template<uint8_t width>
+	static void fillEdge(uint8_t * buffer, const WallColumn & column, int16_t previous, int16_t current)
+	{
+		int16_t from;
+		int16_t to;
+
+		WallColumn::getEdgeRows(previous, current, from, to);
+
+		uint8_t top;
+		uint8_t bottom;
+
+		if(column.clip(from, to, top, bottom))
+			framebuffer::fillColumn<width>(buffer, column.x, top, bottom, 0xFF);
+	}
+};
+
+/// Fills walls with an ordered dither that grows darker with distance, outlined solidly.
+/// The renderer gives each column a brightness from the wall's depth and its sector's light,
+/// and the column is filled with that brightness's mask a page at a time, as a solid fill would be.
+struct ShadedWallPolicy
+{
+	// Whether the renderer needs to calculate projectedU
+	static constexpr bool isTextured()
+	{
+		return false;
+	}
+
+	// Whether the renderer needs to calculate brightness
+	static constexpr bool isLit()
+	{
+		return true;
+	}
+
+	template<typename Renderer>
+	void drawColumn(Renderer & renderer, const WallColumn & column) const
+	{
+		uint8_t top;
+		uint8_t bottom;
+
+		if(!column.clip(column.top, column.bottom, top, bottom))
+			return;
+
+		uint8_t * buffer = renderer.getBuffer();
+
+		if(column.isLeftEnd || column.isRightEnd)
+		{
+			framebuffer::fillColumn<Renderer::width()>(buffer, column.x, top, bottom, 0xFF);
+			return;
+		}
+
+		framebuffer::fillColumn<Renderer::width()>(buffer, column.x, top, bottom, dither::getMask(column.brightness, column.x));
+
+		// Top
+		DitheredWallPolicy::fillEdge<Renderer::width()>(buffer, column, column.previousTop, column.top);
+
+		// Bottom
+		DitheredWallPolicy::fillEdge<Renderer::width()>(buffer, column, column.previousBottom, column.bottom);
+	}
+};
+
+/// Maps a texture onto walls with perspective correction.
+/// The texture is one unit tall, hung from the wall's top edge, and the texels are square,
+/// so the texture repeats every (width / height) units along a wall.
+/// It isn't repeated down walls taller than a unit.
+/// One reciprocal per column gives both the texture column and the vertical step.
+template<typename TextureType>
+struct TexturedWallPolicy
+{
+private:
+	TextureType texture;
+
+public:
+	constexpr TexturedWallPolicy(const TextureType & texture) :
+		texture { texture }
+	{
+	}
+
+	static constexpr bool isTextured()
+	{
+		return true;
+	}
+
+	static constexpr bool isLit()
+	{
+		return false;
+	}
+
+	template<typename Renderer>
+	void drawColumn(Renderer & renderer, const WallColumn & column) const
+	{
+		uint8_t top;
+		uint8_t bottom;
+
+		if(!column.clip(column.top, column.bottom, top, bottom))
+			return;
+
+		const SQ15x16 inverseHalfHeight = maths::reciprocal(column.halfHeight);
+
+		const uint8_t textureWidth = this->texture.getWidth();
+		const uint8_t textureHeight = this->texture.getHeight();
+
+		// The distance along the wall, in texels
+		const SQ15x16 u = ((column.projectedU * inverseHalfHeight) * textureHeight);
+		const uint8_t textureX = static_cast<uint8_t>(static_cast<uint16_t>(u) % textureWidth);
+
+		// The texture's height covers the wall's full height
+		const SQ15x16 step = ((SQ15x16(textureHeight) * inverseHalfHeight) * SQ15x16(0.5));
+
+		TextureRenderer<Renderer>::drawColumn(renderer, this->texture, column.x, textureX, column.exactTop, step, top, bottom);
+	}
+};
\ No newline at end of file
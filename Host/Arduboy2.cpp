@@ -0,0 +1,256 @@
+#include "Arduboy2.h"
+
+// For snprintf, printf
+#include <stdio.h>
+
+// For memset
+#include <string.h>
+
+// For steady_clock
+#include <chrono>
+
+uint8_t Arduboy2::sBuffer[(WIDTH * HEIGHT) / 8];
+
+HostCounters Arduboy2::counters;
+
+//
+// Arduino
+//
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	const Clock::time_point startTime = Clock::now();
+}
+
+uint32_t micros()
+{
+	return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime).count());
+}
+
+uint32_t millis()
+{
+	return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - startTime).count());
+}
+
+HostSerial Serial;
+
+void HostSerial::begin(unsigned long)
+{
+}
+
+size_t HostSerial::print(const char * string)
+{
+	return static_cast<size_t>(printf("%s", string));
+}
+
+size_t HostSerial::print(char character)
+{
+	return static_cast<size_t>(printf("%c", character));
+}
+
+size_t HostSerial::print(unsigned long value, int base)
+{
+	return static_cast<size_t>(printf((base == 16) ? "%lX" : "%lu", value));
+}
+
+//
+// Frame buffer
+//
+
+void Arduboy2::clear()
+{
+	fillScreen(BLACK);
+}
+
+void Arduboy2::fillScreen(uint8_t colour)
+{
+	memset(sBuffer, (colour != BLACK) ? 0xFF : 0x00, sizeof(sBuffer));
+}
+
+void Arduboy2::display()
+{
+	++counters.displayCalls;
+}
+
+//
+// Drawing
+//
+
+void Arduboy2::drawPixel(int16_t x, int16_t y, uint8_t colour)
+{
+	if((x < 0) || (x >= WIDTH) || (y < 0) || (y >= HEIGHT))
+		return;
+
+	++counters.pixelWrites;
+
+	const uint16_t index = (((y / 8) * WIDTH) + x);
+	const uint8_t bitMask = (1 << (y % 8));
+
+	if(colour != BLACK)
+		sBuffer[index] |= bitMask;
+	else
+		sBuffer[index] &= ~bitMask;
+}
+
+uint8_t Arduboy2::getPixel(uint8_t x, uint8_t y)
+{
+	const uint16_t index = (((y / 8) * WIDTH) + x);
+	const uint8_t bitShift = (y % 8);
+
+	return ((sBuffer[index] >> bitShift) & 1);
+}
+
+void Arduboy2::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t colour)
+{
+	++counters.lineCalls;
+
+	// Bresenham, plotting every pixel through drawPixel like the library does
+	const bool steep = (((y1 > y0) ? (y1 - y0) : (y0 - y1)) > ((x1 > x0) ? (x1 - x0) : (x0 - x1)));
+
+	if(steep)
+	{
+		int16_t temporary = x0;
+		x0 = y0;
+		y0 = temporary;
+
+		temporary = x1;
+		x1 = y1;
+		y1 = temporary;
+	}
+
+	if(x0 > x1)
+	{
+		int16_t temporary = x0;
+		x0 = x1;
+		x1 = temporary;
+
+		temporary = y0;
+		y0 = y1;
+		y1 = temporary;
+	}
+
+	const int16_t deltaX = (x1 - x0);
+	const int16_t deltaY = ((y1 > y0) ? (y1 - y0) : (y0 - y1));
+	const int8_t stepY = ((y0 < y1) ? 1 : -1);
+
+	int16_t error = (deltaX / 2);
+
+	for(; x0 <= x1; ++x0)
+	{
+		if(steep)
+			drawPixel(y0, x0, colour);
+		else
+			drawPixel(x0, y0, colour);
+
+		error -= deltaY;
+
+		if(error < 0)
+		{
+			y0 += stepY;
+			error += deltaX;
+		}
+	}
+}
+
+void Arduboy2::drawFastVLine(int16_t x, int16_t y, uint8_t height, uint8_t colour)
+{
+	++counters.verticalLineCalls;
+
+	const int16_t end = (y + height);
+
+	for(int16_t a = y; a < end; ++a)
+		drawPixel(x, a, colour);
+}
+
+void Arduboy2::drawFastHLine(int16_t x, int16_t y, uint8_t width, uint8_t colour)
+{
+	++counters.horizontalLineCalls;
+
+	const int16_t end = (x + width);
+
+	for(int16_t a = x; a < end; ++a)
+		drawPixel(a, y, colour);
+}
+
+//
+// Text
+//
+
+size_t Arduboy2::write(uint8_t character)
+{
+	++counters.charactersPrinted;
+
+	// The library's font is 5x7 with a 1 pixel gap
+	if(character == '\n')
+	{
+		this->cursorX = 0;
+		this->cursorY += 8;
+	}
+	else
+	{
+		this->cursorX += 6;
+	}
+
+	return 1;
+}
+
+size_t Arduboy2::printText(const char * text)
+{
+	size_t count = 0;
+
+	for(; text[count] != '\0'; ++count)
+		this->write(static_cast<uint8_t>(text[count]));
+
+	return count;
+}
+
+size_t Arduboy2::print(const char * string)
+{
+	return this->printText(string);
+}
+
+size_t Arduboy2::print(char character)
+{
+	return this->write(static_cast<uint8_t>(character));
+}
+
+size_t Arduboy2::print(unsigned char value, int base)
+{
+	return this->print(static_cast<unsigned long>(value), base);
+}
+
+size_t Arduboy2::print(int value, int base)
+{
+	return this->print(static_cast<long>(value), base);
+}
+
+size_t Arduboy2::print(unsigned int value, int base)
+{
+	return this->print(static_cast<unsigned long>(value), base);
+}
+
+size_t Arduboy2::print(long value, int base)
+{
+	if(base == 16)
+		return this->print(static_cast<unsigned long>(value), base);
+
+	char text[24];
+	snprintf(text, sizeof(text), "%ld", value);
+	return this->printText(text);
+}
+
+size_t Arduboy2::print(unsigned long value, int base)
+{
+	char text[24];
+	snprintf(text, sizeof(text), (base == 16) ? "%lX" : "%lu", value);
+	return this->printText(text);
+}
+
+size_t Arduboy2::print(double value, int digits)
+{
+	char text[32];
+	snprintf(text, sizeof(text), "%.*f", digits, value);
+	return this->printText(text);
+}
\ No newline at end of file
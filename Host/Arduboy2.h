@@ -0,0 +1,165 @@
+#pragma once
+
+// Host stand-in for the Arduboy2 library.
+// Draws into the same 1KB page-layout buffer as the real thing,
+// but has no display and counts the work that the game asks it to do.
+
+// For uint8_t, int16_t, uint32_t
+#include <stdint.h>
+
+// For size_t
+#include <stddef.h>
+
+#include "Arduino.h"
+
+#define WIDTH 128
+#define HEIGHT 64
+
+#define BLACK 0
+#define WHITE 1
+
+#define LEFT_BUTTON (1 << 5)
+#define RIGHT_BUTTON (1 << 6)
+#define UP_BUTTON (1 << 7)
+#define DOWN_BUTTON (1 << 4)
+#define A_BUTTON (1 << 3)
+#define B_BUTTON (1 << 2)
+
+/// Counts of the drawing operations performed since the last reset.
+struct HostCounters
+{
+	uint32_t pixelWrites;
+	uint32_t lineCalls;
+	uint32_t verticalLineCalls;
+	uint32_t horizontalLineCalls;
+	uint32_t charactersPrinted;
+	uint32_t displayCalls;
+};
+
+class Arduboy2
+{
+public:
+	static uint8_t sBuffer[(WIDTH * HEIGHT) / 8];
+
+	static HostCounters counters;
+
+private:
+	uint8_t currentButtonState = 0;
+	uint8_t previousButtonState = 0;
+	uint8_t nextButtonState = 0;
+
+	int16_t cursorX = 0;
+	int16_t cursorY = 0;
+
+public:
+	void begin()
+	{
+		this->clear();
+	}
+
+	static constexpr uint8_t width()
+	{
+		return WIDTH;
+	}
+
+	static constexpr uint8_t height()
+	{
+		return HEIGHT;
+	}
+
+	static uint8_t * getBuffer()
+	{
+		return sBuffer;
+	}
+
+	/// There is no frame rate limit on the host.
+	bool nextFrame()
+	{
+		return true;
+	}
+
+	//
+	// Buttons
+	//
+
+	/// Host only: sets the buttons that will be held at the next pollButtons.
+	void setButtonState(uint8_t buttons)
+	{
+		this->nextButtonState = buttons;
+	}
+
+	uint8_t buttonsState() const
+	{
+		return this->currentButtonState;
+	}
+
+	void pollButtons()
+	{
+		this->previousButtonState = this->currentButtonState;
+		this->currentButtonState = this->nextButtonState;
+	}
+
+	bool pressed(uint8_t buttons) const
+	{
+		return ((this->currentButtonState & buttons) == buttons);
+	}
+
+	bool justPressed(uint8_t button) const
+	{
+		return (((this->previousButtonState & button) == 0) && ((this->currentButtonState & button) != 0));
+	}
+
+	bool justReleased(uint8_t button) const
+	{
+		return (((this->previousButtonState & button) != 0) && ((this->currentButtonState & button) == 0));
+	}
+
+	//
+	// Frame buffer
+	//
+
+	static void clear();
+
+	static void fillScreen(uint8_t colour);
+
+	void display();
+
+	//
+	// Drawing
+	//
+
+	static void drawPixel(int16_t x, int16_t y, uint8_t colour = WHITE);
+
+	static uint8_t getPixel(uint8_t x, uint8_t y);
+
+	void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t colour = WHITE);
+
+	void drawFastVLine(int16_t x, int16_t y, uint8_t height, uint8_t colour = WHITE);
+
+	void drawFastHLine(int16_t x, int16_t y, uint8_t width, uint8_t colour = WHITE);
+
+	//
+	// Text
+	// Characters are counted and advance the cursor, but are not drawn.
+	//
+
+	void setCursor(int16_t x, int16_t y)
+	{
+		this->cursorX = x;
+		this->cursorY = y;
+	}
+
+	size_t write(uint8_t character);
+
+	size_t print(const char * string);
+	size_t print(char character);
+	size_t print(unsigned char value, int base = DEC);
+	size_t print(int value, int base = DEC);
+	size_t print(unsigned int value, int base = DEC);
+	size_t print(long value, int base = DEC);
+	size_t print(unsigned long value, int base = DEC);
+	size_t print(double value, int digits = 2);
+
+private:
+	size_t printText(const char * text);
+};
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+// Host stand-in for the parts of Arduino.h that the game relies on.
+
+// For sin, cos, sqrt
+#include <math.h>
+
+// For uint8_t, uint32_t
+#include <stdint.h>
+
+// For size_t
+#include <stddef.h>
+
+#include <avr/pgmspace.h>
+
+#define DEC 10
+
+/// Microseconds since the first call, measured with steady_clock.
+uint32_t micros();
+
+/// Milliseconds since the first call, measured with steady_clock.
+uint32_t millis();
+
+/// Host stand-in for the USB serial port, which writes to standard output.
+class HostSerial
+{
+public:
+	void begin(unsigned long baud);
+
+	size_t print(const char * string);
+	size_t print(char character);
+	size_t print(unsigned long value, int base = DEC);
+};
+
+extern HostSerial Serial;
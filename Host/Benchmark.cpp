@@ -0,0 +1,615 @@
+// Times SectorRenderer on the host over a scripted camera path.
+//
+// Usage: benchmark [frames]
+//
+// Every case renders the same path, so the checksum of the frames it draws
+// only changes when the output does. Compare it before and after a change
+// that is meant to be a pure optimisation.
+
+#include <Arduboy2.h>
+
+// For printf
+#include <stdio.h>
+
+// For atoi
+#include <stdlib.h>
+
+// For steady_clock
+#include <chrono>
+
+// For cos, sin
+#include <math.h>
+
+// For std::vector
+#include <vector>
+
+#include "Camera.h"
+#include "Level.h"
+#include "SectorRenderer.h"
+#include "SpriteRenderer.h"
+#include "DummyData.h"
+
+#include "LevelBuilder.h"
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	struct Map
+	{
+		const char * name;
+		Level level;
+
+		// The camera walks back and forth between these points
+		Point2SQ15x16 pathStart;
+		Point2SQ15x16 pathEnd;
+	};
+
+	// Entities of the map being run, in rows along the path and in a crowd around it
+	EntityPool<48> pathEntities;
+	EntityPool<4096> crowdEntities;
+
+	// Entities that move and are replaced every frame, timed without rendering
+	EntityPool<4096> stressEntities;
+
+	// Returns the cull statistics of the 3D view, if any
+	using RenderFunction = CullStatistics (*)(Arduboy2 & arduboy, const Camera & camera, const Level & level);
+
+	struct Case
+	{
+		const char * name;
+		RenderFunction render;
+	};
+
+	// The lightest settings: frame buffer lines, clipping to the near plane only, and no debug overlay
+	struct LeanConfig : DefaultSectorRendererConfig
+	{
+		using WallPolicy = WireframeWallPolicy<FrameBufferLinePolicy>;
+		using Clipping = NearPlaneClipping;
+
+		static constexpr bool isDebugOverlayDrawn()
+		{
+			return false;
+		}
+	};
+
+	// The default settings, with the transform cache that the game ships, a slot for each point of the dummy level.
+	// Larger maps share its slots between points, as they would in the game.
+	struct CachedConfig : DefaultSectorRendererConfig
+	{
+		static constexpr uint16_t vertexCacheCapacity()
+		{
+			return dummyLevelPointCount;
+		}
+	};
+
+	using CachedRenderer = SectorRenderer<Arduboy2, CachedConfig>;
+
+	// The default settings, with the floor and ceiling filled
+	struct FlatsConfig : DefaultSectorRendererConfig
+	{
+		static constexpr bool areFlatsDrawn()
+		{
+			return true;
+		}
+	};
+
+	// Reset for each map
+	CachedRenderer::TransformCache transformCache;
+
+	// The camera walks the path without turning, as when strafing
+	Camera getStrafingCamera(const Camera & camera)
+	{
+		return { BinaryAngleU16(0), camera.position, camera.sector, camera.height };
+	}
+
+	CullStatistics render3D(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2>::render3D(arduboy, camera, level);
+	}
+
+	CullStatistics renderFrameBufferLines(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2>::render3D(arduboy, camera, level, WireframeWallPolicy<FrameBufferLinePolicy>());
+	}
+
+	CullStatistics renderCached(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return CachedRenderer::render3D(arduboy, camera, level, CachedConfig::WallPolicy(), nullptr, &transformCache);
+	}
+
+	CullStatistics renderStrafe(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2>::render3D(arduboy, getStrafingCamera(camera), level);
+	}
+
+	CullStatistics renderStrafeCached(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return CachedRenderer::render3D(arduboy, getStrafingCamera(camera), level, CachedConfig::WallPolicy(), nullptr, &transformCache);
+	}
+
+	CullStatistics renderLean(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2, LeanConfig>::render3D(arduboy, camera, level);
+	}
+
+	CullStatistics renderSolid(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2>::render3D<SolidWallPolicy>(arduboy, camera, level);
+	}
+
+	CullStatistics renderDithered(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2>::render3D<DitheredWallPolicy>(arduboy, camera, level);
+	}
+
+	CullStatistics renderTextured(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2>::render3D(arduboy, camera, level, TexturedWallPolicy<ProgmemTexture>(ProgmemTexture(dummyTexture)));
+	}
+
+	CullStatistics renderShaded(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2>::render3D(arduboy, camera, level, ShadedWallPolicy());
+	}
+
+	CullStatistics renderFlats(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2, FlatsConfig>::render3D(arduboy, camera, level);
+	}
+
+	CullStatistics renderBspFlats(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2, FlatsConfig>::render3DBsp(arduboy, camera, level, SolidWallPolicy());
+	}
+
+	CullStatistics renderBsp(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2>::render3DBsp(arduboy, camera, level);
+	}
+
+	CullStatistics renderBspSolid(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return SectorRenderer<Arduboy2>::render3DBsp(arduboy, camera, level, SolidWallPolicy());
+	}
+
+	template<uint16_t Capacity>
+	CullStatistics renderWithSprites(Arduboy2 & arduboy, const Camera & camera, const Level & level, const EntityPool<Capacity> & entities)
+	{
+		DepthBuffer<Arduboy2::width()> depthBuffer;
+
+		const CullStatistics statistics = SectorRenderer<Arduboy2>::render3D(arduboy, camera, level, DefaultSectorRendererConfig::WallPolicy(), &depthBuffer);
+		SpriteRenderer<Arduboy2>::render(arduboy, camera, level, entities, dummySprites, depthBuffer);
+		return statistics;
+	}
+
+	CullStatistics renderSprites(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return renderWithSprites(arduboy, camera, level, pathEntities);
+	}
+
+	CullStatistics renderCrowd(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		return renderWithSprites(arduboy, camera, level, crowdEntities);
+	}
+
+	CullStatistics render2D(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		SectorRenderer<Arduboy2>::render2D(arduboy, camera, level);
+		return {};
+	}
+
+	CullStatistics render2DFrameBufferLines(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		SectorRenderer<Arduboy2>::render2D(arduboy, camera, level, FrameBufferLinePolicy());
+		return {};
+	}
+
+	CullStatistics renderBoth(Arduboy2 & arduboy, const Camera & camera, const Level & level)
+	{
+		const CullStatistics statistics = SectorRenderer<Arduboy2>::render3D(arduboy, camera, level);
+		SectorRenderer<Arduboy2>::render2D(arduboy, camera, level);
+		return statistics;
+	}
+
+	const Case cases[]
+	{
+		{ "render3D", render3D },
+		{ "fb-lines", renderFrameBufferLines },
+		{ "lean", renderLean },
+		{ "cached", renderCached },
+		{ "strafe", renderStrafe },
+		{ "strafe-vc", renderStrafeCached },
+		{ "solid", renderSolid },
+		{ "dithered", renderDithered },
+		{ "textured", renderTextured },
+		{ "shaded", renderShaded },
+		{ "flats", renderFlats },
+		{ "bsp", renderBsp },
+		{ "bsp-solid", renderBspSolid },
+		{ "bsp-flats", renderBspFlats },
+		{ "sprites", renderSprites },
+		{ "crowd", renderCrowd },
+		{ "render2D", render2D },
+		{ "2D-fb", render2DFrameBufferLines },
+		{ "both", renderBoth },
+	};
+
+	std::vector<uint8_t> build(LevelBuilder & builder, bool allowConcave)
+	{
+		std::vector<uint8_t> data;
+
+		if(!builder.build(data, allowConcave))
+		{
+			fprintf(stderr, "Can't generate a map: %s\n", builder.getError().c_str());
+			exit(1);
+		}
+
+		return data;
+	}
+
+	/// Generates a star-shaped sector centred on (128, 128) with solid walls.
+	/// Alternate points are pulled inwards so that walls overlap on screen.
+	std::vector<uint8_t> generateSector(uint8_t pointCount, double radius)
+	{
+		LevelBuilder builder;
+		builder.addSector();
+
+		for(uint8_t index = 0; index < pointCount; ++index)
+		{
+			const double angle = ((constants::Tau<double>::value * index) / pointCount);
+			const double distance = ((index % 2) == 0) ? radius : ((radius * 3) / 4);
+
+			builder.addPoint((128 + (cos(angle) * distance)), (128 + (sin(angle) * distance)), noSector);
+		}
+
+		return build(builder, true);
+	}
+
+	/// Generates a grid of square sectors joined by portals, with a solid pillar in every third cell.
+	/// Terraced grids vary the floor and ceiling heights from cell to cell, so that most portals have steps.
+	template<uint8_t width, uint8_t height, uint8_t cellSize>
+	std::vector<uint8_t> generateGrid(bool isTerraced = false)
+	{
+		SectorId cellSectors[height][width];
+		uint8_t sectorCount = 0;
+
+		const auto isPillar = [](uint8_t x, uint8_t y)
+		{
+			return (((x % 3) == 1) && ((y % 3) == 1));
+		};
+
+		const auto getCellSector = [&cellSectors](int16_t x, int16_t y)
+		{
+			if((x < 0) || (x >= width) || (y < 0) || (y >= height))
+				return noSector;
+
+			return cellSectors[y][x];
+		};
+
+		for(uint8_t y = 0; y < height; ++y)
+			for(uint8_t x = 0; x < width; ++x)
+				cellSectors[y][x] = isPillar(x, y) ? noSector : sectorCount++;
+
+		LevelBuilder builder;
+
+		for(uint8_t y = 0; y < height; ++y)
+			for(uint8_t x = 0; x < width; ++x)
+			{
+				if(cellSectors[y][x] == noSector)
+					continue;
+
+				const double left = (x * cellSize);
+				const double top = (y * cellSize);
+				const double right = (left + cellSize);
+				const double bottom = (top + cellSize);
+
+				// Floors rise by up to three eighths of a unit and ceilings fall by up to a quarter, so the eye always stays between them
+				const double floorHeight = isTerraced ? (((x + y) % 4) * 0.125) : 0;
+				const double ceilingHeight = isTerraced ? (1.25 - ((((2 * x) + y) % 3) * 0.125)) : 1;
+
+				// Anticlockwise, each point followed by the sector across the next edge
+				builder.addSector(floorHeight, ceilingHeight);
+				builder.addPoint(left, top, getCellSector(x, (y - 1)));
+				builder.addPoint(right, top, getCellSector((x + 1), y));
+				builder.addPoint(right, bottom, getCellSector(x, (y + 1)));
+				builder.addPoint(left, bottom, getCellSector((x - 1), y));
+			}
+
+		return build(builder, false);
+	}
+
+	/// Fills a pool with entities in two rows either side of the path, to be walked past and through.
+	template<uint16_t Capacity>
+	void placeAlongPath(EntityPool<Capacity> & entities, const Map & map)
+	{
+		entities.clear();
+
+		for(uint16_t index = 0; index < Capacity; ++index)
+		{
+			const SQ15x16 factor = (SQ15x16(index) / SQ15x16(Capacity - 1));
+			const SQ15x16 offset = ((index % 2) == 0) ? SQ15x16(-3) : SQ15x16(3);
+
+			const Point2SQ15x16 position { maths::lerp(map.pathStart.x, map.pathEnd.x, factor), (maths::lerp(map.pathStart.y, map.pathEnd.y, factor) + offset) };
+			entities.create(position, {}, 0);
+		}
+	}
+
+	/// Fills a pool with entities on a square lattice centred on the middle of the path,
+	/// a quarter of a unit apart, so that most are culled and the nearest overflow the visible list.
+	template<uint16_t Capacity>
+	void placeCrowd(EntityPool<Capacity> & entities, const Map & map)
+	{
+		entities.clear();
+
+		const uint16_t side = static_cast<uint16_t>(sqrt(Capacity));
+		const SQ15x16 spacing = 0.25;
+
+		const Point2SQ15x16 centre { maths::lerp(map.pathStart.x, map.pathEnd.x, SQ15x16(0.5)), maths::lerp(map.pathStart.y, map.pathEnd.y, SQ15x16(0.5)) };
+		const Vector2SQ15x16 corner { -(spacing * side) / 2, -(spacing * side) / 2 };
+
+		for(uint16_t y = 0; y < side; ++y)
+			for(uint16_t x = 0; x < side; ++x)
+				entities.create((centre + corner + Vector2SQ15x16 { spacing * x, spacing * y }), {}, 0);
+	}
+
+	/// Gets the camera for a frame of the path.
+	/// The camera walks back and forth along the path while turning,
+	/// so that it sees the map from many positions and angles.
+	Camera getCamera(const Map & map, uint16_t frame, uint16_t frameCount, SectorId sectorHint)
+	{
+		const uint16_t halfFrameCount = (frameCount / 2);
+		const uint16_t step = (frame < halfFrameCount) ? frame : (frameCount - frame);
+
+		const SQ15x16 factor = (halfFrameCount > 0) ? (SQ15x16(step) / SQ15x16(halfFrameCount)) : SQ15x16(0);
+		const Point2SQ15x16 position { maths::lerp(map.pathStart.x, map.pathEnd.x, factor), maths::lerp(map.pathStart.y, map.pathEnd.y, factor) };
+
+		const BinaryAngleU16 viewAngle { static_cast<uint16_t>((65536ul * 3 * frame) / frameCount) };
+
+		const SectorId sector = map.level.findSector(position, sectorHint);
+		const SectorId cameraSector = (sector != noSector) ? sector : sectorHint;
+
+		// The eye is halfway up a wall standing on the floor
+		const SQ15x16 eyeHeight = (SQ15x16(map.level.getSector(cameraSector).getFloorHeight()) + SQ15x16(0.5));
+
+		return { viewAngle, position, cameraSector, eyeHeight };
+	}
+
+	/// FNV-1a over the frame buffer, chained across frames.
+	uint32_t hashFrame(uint32_t hash)
+	{
+		const uint8_t * buffer = Arduboy2::getBuffer();
+
+		for(size_t index = 0; index < sizeof(Arduboy2::sBuffer); ++index)
+		{
+			hash ^= buffer[index];
+			hash *= 16777619u;
+		}
+
+		return hash;
+	}
+
+	void runCase(Arduboy2 & arduboy, const Map & map, const Case & benchmarkCase, uint16_t frameCount)
+	{
+		// One untimed pass to produce the checksum and the counts
+		Arduboy2::counters = HostCounters();
+		uint32_t walls = 0;
+		uint32_t behindNearPlane = 0;
+		uint32_t outsideView = 0;
+		uint32_t backFacing = 0;
+		uint32_t checksum = 2166136261u;
+		SectorId sector = 0;
+
+		for(uint16_t frame = 0; frame < frameCount; ++frame)
+		{
+			const Camera camera = getCamera(map, frame, frameCount, sector);
+			sector = camera.sector;
+
+			arduboy.clear();
+			const CullStatistics statistics = benchmarkCase.render(arduboy, camera, map.level);
+			checksum = hashFrame(checksum);
+
+			walls += statistics.walls;
+			behindNearPlane += statistics.behindNearPlane;
+			outsideView += statistics.outsideView;
+			backFacing += statistics.backFacing;
+		}
+
+		const HostCounters counters = Arduboy2::counters;
+
+		// Repeat the timed pass until enough time has passed to be meaningful
+		uint32_t repetitions = 0;
+		const Clock::time_point start = Clock::now();
+		Clock::duration elapsed;
+
+		do
+		{
+			sector = 0;
+
+			for(uint16_t frame = 0; frame < frameCount; ++frame)
+			{
+				const Camera camera = getCamera(map, frame, frameCount, sector);
+				sector = camera.sector;
+
+				arduboy.clear();
+				benchmarkCase.render(arduboy, camera, map.level);
+			}
+
+			++repetitions;
+			elapsed = (Clock::now() - start);
+		}
+		while(elapsed < std::chrono::milliseconds(200));
+
+		const double frames = (static_cast<double>(repetitions) * frameCount);
+		const double nanoseconds = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+		printf("%-10s %-10s %10.0f %10.1f %8.2f %8.2f %8.2f %7.1f %7.1f %7.1f %7.1f %08X\n",
+			map.name, benchmarkCase.name,
+			(nanoseconds / frames),
+			(static_cast<double>(counters.pixelWrites) / frameCount),
+			(static_cast<double>(counters.lineCalls) / frameCount),
+			(static_cast<double>(counters.verticalLineCalls) / frameCount),
+			(static_cast<double>(counters.charactersPrinted) / frameCount),
+			(static_cast<double>(walls) / frameCount),
+			(static_cast<double>(behindNearPlane) / frameCount),
+			(static_cast<double>(outsideView) / frameCount),
+			(static_cast<double>(backFacing) / frameCount),
+			checksum);
+	}
+
+	/// A linear congruential generator, so that every run spawns the same entities.
+	uint32_t nextRandom(uint32_t & seed)
+	{
+		seed = ((seed * 1664525u) + 1013904223u);
+		return (seed >> 16);
+	}
+
+	/// Fills the pool with entities at random in a 256 unit square, moving up to half a unit a frame.
+	/// Each is given a random age, so that they don't all expire together.
+	template<uint16_t Capacity>
+	uint16_t spawnEntities(EntityPool<Capacity> & entities, uint32_t & seed, uint8_t lifetime)
+	{
+		uint16_t spawned = 0;
+
+		while(!entities.isFull())
+		{
+			const Point2SQ15x16 position { SQ15x16(static_cast<uint8_t>(nextRandom(seed))), SQ15x16(static_cast<uint8_t>(nextRandom(seed))) };
+			const Vector2SQ15x16 velocity { SQ15x16::fromInternal(static_cast<int32_t>(nextRandom(seed) % 0x10000) - 0x8000), SQ15x16::fromInternal(static_cast<int32_t>(nextRandom(seed) % 0x10000) - 0x8000) };
+
+			entities.create(position, velocity, 0, static_cast<uint8_t>(nextRandom(seed) % lifetime));
+			++spawned;
+		}
+
+		return spawned;
+	}
+
+	/// Runs a frame: every entity moves and ages, bouncing off the sides of the square,
+	/// then those past their lifetime are destroyed and replaced.
+	/// Returns how many were replaced.
+	template<uint16_t Capacity>
+	uint16_t updateEntities(EntityPool<Capacity> & entities, uint32_t & seed, uint8_t lifetime)
+	{
+		entities.update([](Point2SQ15x16 & position, Vector2SQ15x16 & velocity, uint8_t, uint8_t & state)
+		{
+			position += velocity;
+
+			if((position.x < 0) || (position.x > 255))
+				velocity.x = -velocity.x;
+
+			if((position.y < 0) || (position.y > 255))
+				velocity.y = -velocity.y;
+
+			++state;
+		});
+
+		entities.destroyIf([lifetime](const Point2SQ15x16 &, const Vector2SQ15x16 &, uint8_t, uint8_t state)
+		{
+			return (state >= lifetime);
+		});
+
+		return spawnEntities(entities, seed, lifetime);
+	}
+
+	/// Times a full pool of entities updated as the game would, with the live entities churning.
+	void runEntityStress(uint16_t frameCount)
+	{
+		constexpr uint8_t lifetime = 32;
+
+		const auto run = [frameCount](uint32_t & replaced)
+		{
+			uint32_t seed = 1;
+
+			stressEntities.clear();
+			spawnEntities(stressEntities, seed, lifetime);
+
+			replaced = 0;
+
+			for(uint16_t frame = 0; frame < frameCount; ++frame)
+				replaced += updateEntities(stressEntities, seed, lifetime);
+		};
+
+		// One untimed pass to produce the checksum, over the positions that remain
+		uint32_t replaced;
+		run(replaced);
+
+		uint32_t checksum = 2166136261u;
+		const Point2SQ15x16 * positions = stressEntities.getPositions();
+
+		for(uint16_t index = 0; index < stressEntities.getCount(); ++index)
+		{
+			checksum = ((checksum ^ static_cast<uint32_t>(positions[index].x.getInternal())) * 16777619u);
+			checksum = ((checksum ^ static_cast<uint32_t>(positions[index].y.getInternal())) * 16777619u);
+		}
+
+		uint32_t repetitions = 0;
+		const Clock::time_point start = Clock::now();
+		Clock::duration elapsed;
+
+		do
+		{
+			uint32_t ignored;
+			run(ignored);
+
+			++repetitions;
+			elapsed = (Clock::now() - start);
+		}
+		while(elapsed < std::chrono::milliseconds(200));
+
+		const double frames = (static_cast<double>(repetitions) * frameCount);
+		const double nanoseconds = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+		printf("\n%-10s %10s %10s %10s %8s\n", "entities", "ns/frame", "ns/entity", "replaced", "checksum");
+		printf("%-10u %10.0f %10.2f %10.1f %08X\n",
+			stressEntities.getCapacity(),
+			(nanoseconds / frames),
+			(nanoseconds / (frames * stressEntities.getCapacity())),
+			(static_cast<double>(replaced) / frameCount),
+			checksum);
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	const uint16_t frameCount = (argc > 1) ? static_cast<uint16_t>(atoi(argv[1])) : 256;
+
+	if(frameCount == 0)
+	{
+		fprintf(stderr, "Usage: %s [frames]\n", argv[0]);
+		return 1;
+	}
+
+	// Small enough that the walls are a good part of the screen's height, so that fills are exercised
+	const std::vector<uint8_t> octagon = generateSector(8, 12);
+	const std::vector<uint8_t> star = generateSector(Sector::maxPoints, 12);
+	const std::vector<uint8_t> grid = generateGrid<9, 9, 16>();
+	const std::vector<uint8_t> terraced = generateGrid<9, 9, 16>(true);
+
+	const Map maps[]
+	{
+		{ "dummy", { dummyLevel }, { 5, 15 }, { 35, 15 } },
+		{ "octagon", { octagon.data() }, { 122, 128 }, { 134, 128 } },
+		{ "star", { star.data() }, { 122, 128 }, { 134, 128 } },
+		{ "grid", { grid.data() }, { 8, 8 }, { 136, 8 } },
+		{ "terraced", { terraced.data() }, { 8, 8 }, { 136, 8 } },
+	};
+
+	Arduboy2 arduboy;
+	arduboy.begin();
+
+	printf("%u frames per case\n", frameCount);
+	printf("%-10s %-10s %10s %10s %8s %8s %8s %7s %7s %7s %7s %8s\n", "map", "case", "ns/frame", "pixels", "lines", "vlines", "chars", "walls", "near", "outside", "back", "checksum");
+
+	for(const Map & map : maps)
+	{
+		placeAlongPath(pathEntities, map);
+		placeCrowd(crowdEntities, map);
+		transformCache.reset();
+
+		for(const Case & benchmarkCase : cases)
+			runCase(arduboy, map, benchmarkCase, frameCount);
+	}
+
+	runEntityStress(frameCount);
+
+	return 0;
+}
\ No newline at end of file
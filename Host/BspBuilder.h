@@ -0,0 +1,389 @@
+#pragma once
+
+// Builds a BSP tree over a level's walls for the compiled level format (see LevelFormat.h).
+// Walls that cross a partition are split in two.
+// Partitions are chosen to split as few walls as possible while keeping the tree balanced,
+// and splitting stops once a set of walls is convex, so that none of them can hide another.
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For sqrt, fabs, fmin, fmax, floor, ceil
+#include <math.h>
+
+// For std::string
+#include <string>
+
+// For std::vector
+#include <vector>
+
+#include "CommonTypes.h"
+#include "LevelFormat.h"
+
+class BspBuilder
+{
+public:
+	struct Segment
+	{
+		double startX;
+		double startY;
+		double endX;
+		double endY;
+
+		// The distance along the edge at each end, multiplied by its texture scale
+		double startU;
+		double endU;
+
+		SectorId sector;
+		SectorId neighbour;
+
+		// levelformat::segment flags
+		uint8_t flags;
+
+		// The index of the edge within its sector
+		uint8_t edge;
+	};
+
+private:
+	struct Box
+	{
+		double minimumX;
+		double minimumY;
+		double maximumX;
+		double maximumY;
+	};
+
+	struct Node
+	{
+		double normalX;
+		double normalY;
+		double distance;
+
+		Box frontBox;
+		Box backBox;
+
+		uint16_t front;
+		uint16_t back;
+	};
+
+	struct Leaf
+	{
+		uint16_t firstSegment;
+		uint8_t segmentCount;
+	};
+
+	enum class Side
+	{
+		Front,
+		Back,
+		Both,
+	};
+
+	// Points closer to a partition than this are on it
+	static constexpr double epsilon()
+	{
+		return (1.0 / 4096);
+	}
+
+	// How much worse splitting a wall is than unbalancing the tree by one wall
+	static constexpr unsigned splitCost()
+	{
+		return 4;
+	}
+
+	std::vector<Node> nodes;
+	std::vector<Leaf> leaves;
+	std::vector<Segment> segments;
+	uint16_t root = 0;
+
+	std::string error;
+
+public:
+	/// Builds the tree over the given walls.
+	/// Returns false and sets the error if the tree is too big for the format.
+	bool build(std::vector<Segment> walls)
+	{
+		this->nodes.clear();
+		this->leaves.clear();
+		this->segments.clear();
+		this->error.clear();
+
+		if(walls.empty())
+			return this->fail("there are no walls");
+
+		return this->buildChild(walls, this->root);
+	}
+
+	const std::string & getError() const
+	{
+		return this->error;
+	}
+
+	/// Writes the tree in the compiled level format.
+	/// 'appendSQ15x16' and 'appendUint16' append values to the output.
+	template<typename AppendSQ15x16, typename AppendUint16>
+	void write(std::vector<uint8_t> & output, AppendSQ15x16 appendSQ15x16, AppendUint16 appendUint16) const
+	{
+		appendUint16(output, this->root);
+		appendUint16(output, static_cast<uint16_t>(this->nodes.size()));
+		appendUint16(output, static_cast<uint16_t>(this->leaves.size()));
+		appendUint16(output, static_cast<uint16_t>(this->segments.size()));
+
+		for(const Node & node : this->nodes)
+		{
+			appendSQ15x16(output, node.normalX);
+			appendSQ15x16(output, node.normalY);
+			appendSQ15x16(output, node.distance);
+			appendBox(output, node.frontBox);
+			appendBox(output, node.backBox);
+			appendUint16(output, node.front);
+			appendUint16(output, node.back);
+		}
+
+		for(const Leaf & leaf : this->leaves)
+		{
+			appendUint16(output, leaf.firstSegment);
+			output.push_back(leaf.segmentCount);
+		}
+
+		for(const Segment & segment : this->segments)
+		{
+			appendSQ15x16(output, segment.startX);
+			appendSQ15x16(output, segment.startY);
+			appendSQ15x16(output, segment.endX);
+			appendSQ15x16(output, segment.endY);
+			appendSQ15x16(output, segment.startU);
+			appendSQ15x16(output, segment.endU);
+			output.push_back(segment.sector);
+			output.push_back(segment.neighbour);
+			output.push_back(segment.flags);
+			output.push_back(segment.edge);
+		}
+	}
+
+private:
+	bool fail(const char * message)
+	{
+		this->error = message;
+		return false;
+	}
+
+	// The unit normal of a wall, pointing to the side it can be seen from
+	static void getNormal(const Segment & segment, double & normalX, double & normalY)
+	{
+		const double edgeX = (segment.endX - segment.startX);
+		const double edgeY = (segment.endY - segment.startY);
+		const double length = sqrt((edgeX * edgeX) + (edgeY * edgeY));
+
+		normalX = (-edgeY / length);
+		normalY = (edgeX / length);
+	}
+
+	static double snap(double side)
+	{
+		return (fabs(side) < epsilon()) ? 0 : side;
+	}
+
+	static Side classify(const Segment & segment, double normalX, double normalY, double distance)
+	{
+		const double startSide = snap(((segment.startX * normalX) + (segment.startY * normalY)) - distance);
+		const double endSide = snap(((segment.endX * normalX) + (segment.endY * normalY)) - distance);
+
+		// Walls along the partition go with the side they face
+		if((startSide == 0) && (endSide == 0))
+		{
+			double segmentNormalX;
+			double segmentNormalY;
+			getNormal(segment, segmentNormalX, segmentNormalY);
+
+			return (((segmentNormalX * normalX) + (segmentNormalY * normalY)) > 0) ? Side::Front : Side::Back;
+		}
+
+		if((startSide >= 0) && (endSide >= 0))
+			return Side::Front;
+
+		if((startSide <= 0) && (endSide <= 0))
+			return Side::Back;
+
+		return Side::Both;
+	}
+
+	// Splits a wall where it crosses a partition, the first part keeping the start
+	static void split(const Segment & segment, double normalX, double normalY, double distance, Segment & first, Segment & second)
+	{
+		const double startSide = (((segment.startX * normalX) + (segment.startY * normalY)) - distance);
+		const double endSide = (((segment.endX * normalX) + (segment.endY * normalY)) - distance);
+
+		const double t = (startSide / (startSide - endSide));
+
+		const double x = (segment.startX + ((segment.endX - segment.startX) * t));
+		const double y = (segment.startY + ((segment.endY - segment.startY) * t));
+		const double u = (segment.startU + ((segment.endU - segment.startU) * t));
+
+		first = segment;
+		first.endX = x;
+		first.endY = y;
+		first.endU = u;
+		first.flags &= ~levelformat::segment::endsBeforePortal;
+
+		second = segment;
+		second.startX = x;
+		second.startY = y;
+		second.startU = u;
+		second.flags &= ~levelformat::segment::startsAfterWall;
+	}
+
+	// Finds the wall whose line best divides the others.
+	// Returns false if every wall is in front of every other, so there is nothing to divide.
+	static bool chooseSplitter(const std::vector<Segment> & walls, size_t & splitter)
+	{
+		bool found = false;
+		unsigned bestCost = 0;
+
+		for(size_t candidate = 0; candidate < walls.size(); ++candidate)
+		{
+			double normalX;
+			double normalY;
+			getNormal(walls[candidate], normalX, normalY);
+
+			const double distance = ((walls[candidate].startX * normalX) + (walls[candidate].startY * normalY));
+
+			unsigned front = 0;
+			unsigned back = 0;
+			unsigned splits = 0;
+
+			for(const Segment & wall : walls)
+				switch(classify(wall, normalX, normalY, distance))
+				{
+					case Side::Front: ++front; break;
+					case Side::Back: ++back; break;
+					case Side::Both: ++front; ++back; ++splits; break;
+				}
+
+			// The candidate itself is always in front, so a partition needs something behind it
+			if(back == 0)
+				continue;
+
+			const unsigned cost = ((splits * splitCost()) + ((front > back) ? (front - back) : (back - front)));
+
+			if(!found || (cost < bestCost))
+			{
+				found = true;
+				bestCost = cost;
+				splitter = candidate;
+			}
+		}
+
+		return found;
+	}
+
+	static Box getBox(const std::vector<Segment> & walls)
+	{
+		Box box { walls[0].startX, walls[0].startY, walls[0].startX, walls[0].startY };
+
+		for(const Segment & wall : walls)
+		{
+			box.minimumX = fmin(box.minimumX, fmin(wall.startX, wall.endX));
+			box.minimumY = fmin(box.minimumY, fmin(wall.startY, wall.endY));
+			box.maximumX = fmax(box.maximumX, fmax(wall.startX, wall.endX));
+			box.maximumY = fmax(box.maximumY, fmax(wall.startY, wall.endY));
+		}
+
+		return box;
+	}
+
+	bool buildChild(const std::vector<Segment> & walls, uint16_t & child)
+	{
+		size_t splitter;
+
+		if(!chooseSplitter(walls, splitter))
+			return this->buildLeaf(walls, child);
+
+		if(this->nodes.size() >= levelformat::bsp::leafFlag)
+			return this->fail("the BSP tree has too many nodes");
+
+		double normalX;
+		double normalY;
+		getNormal(walls[splitter], normalX, normalY);
+
+		const double distance = ((walls[splitter].startX * normalX) + (walls[splitter].startY * normalY));
+
+		std::vector<Segment> front;
+		std::vector<Segment> back;
+
+		for(const Segment & wall : walls)
+			switch(classify(wall, normalX, normalY, distance))
+			{
+				case Side::Front:
+					front.push_back(wall);
+					break;
+
+				case Side::Back:
+					back.push_back(wall);
+					break;
+
+				case Side::Both:
+				{
+					Segment first;
+					Segment second;
+					split(wall, normalX, normalY, distance, first, second);
+
+					const bool startInFront = ((((wall.startX * normalX) + (wall.startY * normalY)) - distance) > 0);
+
+					(startInFront ? front : back).push_back(first);
+					(startInFront ? back : front).push_back(second);
+					break;
+				}
+			}
+
+		// Nodes are numbered before their children, so the first node is the root
+		const size_t index = this->nodes.size();
+		child = static_cast<uint16_t>(index);
+
+		this->nodes.push_back({ normalX, normalY, distance, getBox(front), getBox(back), 0, 0 });
+
+		uint16_t frontChild;
+		uint16_t backChild;
+
+		if(!this->buildChild(front, frontChild) || !this->buildChild(back, backChild))
+			return false;
+
+		this->nodes[index].front = frontChild;
+		this->nodes[index].back = backChild;
+
+		return true;
+	}
+
+	bool buildLeaf(const std::vector<Segment> & walls, uint16_t & child)
+	{
+		if(this->leaves.size() >= levelformat::bsp::leafFlag)
+			return this->fail("the BSP tree has too many leaves");
+
+		if(walls.size() > 0xFF)
+			return this->fail("a BSP leaf has more than 255 walls");
+
+		if((this->segments.size() + walls.size()) > 0xFFFF)
+			return this->fail("the BSP tree has too many walls");
+
+		child = static_cast<uint16_t>(this->leaves.size() | levelformat::bsp::leafFlag);
+
+		this->leaves.push_back({ static_cast<uint16_t>(this->segments.size()), static_cast<uint8_t>(walls.size()) });
+		this->segments.insert(this->segments.end(), walls.begin(), walls.end());
+
+		return true;
+	}
+
+	// Boxes are stored as bytes, rounded outwards so that they still contain their walls
+	static void appendBox(std::vector<uint8_t> & output, const Box & box)
+	{
+		output.push_back(clampToByte(floor(box.minimumX)));
+		output.push_back(clampToByte(floor(box.minimumY)));
+		output.push_back(clampToByte(ceil(box.maximumX)));
+		output.push_back(clampToByte(ceil(box.maximumY)));
+	}
+
+	static uint8_t clampToByte(double value)
+	{
+		return static_cast<uint8_t>((value < 0) ? 0 : (value > 255) ? 255 : value);
+	}
+};
\ No newline at end of file
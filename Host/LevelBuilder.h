@@ -0,0 +1,364 @@
+#pragma once
+
+// Builds levels in the compiled level format (see LevelFormat.h).
+// Used by the level compiler, and by the benchmark to generate maps.
+// Works in doubles and rounds once, so the precomputed data is as exact as the format allows.
+
+// For uint8_t, uint16_t, int32_t
+#include <stdint.h>
+
+// For sqrt, hypot, lround
+#include <math.h>
+
+// For snprintf
+#include <stdio.h>
+
+// For std::string
+#include <string>
+
+// For std::vector
+#include <vector>
+
+#include "CommonTypes.h"
+#include "LevelFormat.h"
+#include "Sector.h"
+
+#include "BspBuilder.h"
+
+class LevelBuilder
+{
+public:
+	struct Point
+	{
+		double x;
+		double y;
+
+		// The sector across the edge from this point to the next
+		SectorId neighbour;
+
+		double textureScale;
+	};
+
+	struct SectorDescription
+	{
+		double floorHeight;
+		double ceilingHeight;
+		uint8_t light;
+
+		std::vector<Point> points;
+	};
+
+	// Heights must stay within this distance of 0, which keeps them within SQ7x8
+	static constexpr double maxHeight()
+	{
+		return 127;
+	}
+
+	// Points must stay within this distance of the origin,
+	// which keeps the renderer's intermediate values within SQ15x16
+	// and lets the BSP tree store its bounding boxes as bytes
+	static constexpr double maxCoordinate()
+	{
+		return 255;
+	}
+
+private:
+	std::vector<SectorDescription> sectors;
+	std::string error;
+
+public:
+	// The light of sectors that aren't given one, out of dither::levelCount at a depth of 1
+	static constexpr uint8_t defaultLight()
+	{
+		return 12;
+	}
+
+	/// Starts a new sector. Its points follow.
+	/// Without heights, the floor is at 0 and the ceiling at 1, a wall's height.
+	void addSector(double floorHeight = 0, double ceilingHeight = 1, uint8_t light = defaultLight())
+	{
+		this->sectors.push_back({ floorHeight, ceilingHeight, light, {} });
+	}
+
+	/// Adds a point to the last sector.
+	void addPoint(double x, double y, SectorId neighbour, double textureScale = 1)
+	{
+		this->sectors.back().points.push_back({ x, y, neighbour, textureScale });
+	}
+
+	size_t getSectorCount() const
+	{
+		return this->sectors.size();
+	}
+
+	/// Gets the number of points in every sector, which is one more than the highest PointId.
+	size_t getPointCount() const
+	{
+		size_t pointCount = 0;
+
+		for(const SectorDescription & sector : this->sectors)
+			pointCount += sector.points.size();
+
+		return pointCount;
+	}
+
+	/// Gets the reason that the last call to build failed.
+	const std::string & getError() const
+	{
+		return this->error;
+	}
+
+	/// Checks the level and writes it to 'output'.
+	/// Returns false and sets the error if the level can't be represented or rendered.
+	/// Concave sectors can be allowed to stress the renderer,
+	/// but the game can't reliably tell whether a point is inside them.
+	bool build(std::vector<uint8_t> & output, bool allowConcave = false)
+	{
+		output.clear();
+
+		if(!this->validate(allowConcave))
+			return false;
+
+		const size_t sectorCount = this->sectors.size();
+
+		output.push_back(levelformat::magic0);
+		output.push_back(levelformat::magic1);
+		output.push_back(levelformat::version);
+		output.push_back(static_cast<uint8_t>(sectorCount));
+
+		// Filled in as each part is written
+		output.resize(output.size() + ((1 + sectorCount) * sizeof(uint16_t)));
+
+		// Sectors have at most Sector::maxPoints points, so this can't reach noPoint
+		PointId firstPoint = 0;
+
+		for(size_t sectorIndex = 0; sectorIndex < sectorCount; ++sectorIndex)
+		{
+			const SectorDescription & sector = this->sectors[sectorIndex];
+			const std::vector<Point> & points = sector.points;
+
+			if(output.size() > 0xFFFF)
+				return this->fail("the level is larger than 64KB");
+
+			writeUint16(output, (levelformat::level::sectorOffsets + (sectorIndex * sizeof(uint16_t))), static_cast<uint16_t>(output.size()));
+
+			double minimumX = points[0].x;
+			double minimumY = points[0].y;
+			double maximumX = points[0].x;
+			double maximumY = points[0].y;
+
+			for(const Point & point : points)
+			{
+				minimumX = (point.x < minimumX) ? point.x : minimumX;
+				minimumY = (point.y < minimumY) ? point.y : minimumY;
+				maximumX = (point.x > maximumX) ? point.x : maximumX;
+				maximumY = (point.y > maximumY) ? point.y : maximumY;
+			}
+
+			output.push_back(static_cast<uint8_t>(points.size()));
+			appendSQ15x16(output, minimumX);
+			appendSQ15x16(output, minimumY);
+			appendSQ15x16(output, maximumX);
+			appendSQ15x16(output, maximumY);
+			appendSQ7x8(output, sector.floorHeight);
+			appendSQ7x8(output, sector.ceilingHeight);
+			output.push_back(sector.light);
+			appendUint16(output, firstPoint);
+
+			firstPoint += static_cast<PointId>(points.size());
+
+			for(size_t index = 0; index < points.size(); ++index)
+			{
+				const Point & point = points[index];
+				const Point & next = points[(index + 1) % points.size()];
+
+				const double edgeX = (next.x - point.x);
+				const double edgeY = (next.y - point.y);
+				const double length = sqrt((edgeX * edgeX) + (edgeY * edgeY));
+
+				appendSQ15x16(output, point.x);
+				appendSQ15x16(output, point.y);
+
+				// Anticlockwise winding puts the inside on the left
+				appendSQ15x16(output, (-edgeY / length));
+				appendSQ15x16(output, (edgeX / length));
+
+				appendSQ15x16(output, length);
+				appendSQ7x8(output, point.textureScale);
+				output.push_back(point.neighbour);
+			}
+		}
+
+		BspBuilder bspBuilder;
+
+		if(!bspBuilder.build(this->getWalls()))
+		{
+			// Already formatted, so it isn't given to fail as a format
+			this->error = bspBuilder.getError();
+			return false;
+		}
+
+		if(output.size() > 0xFFFF)
+			return this->fail("the level is larger than 64KB");
+
+		writeUint16(output, levelformat::level::bspOffset, static_cast<uint16_t>(output.size()));
+		bspBuilder.write(output, appendSQ15x16, appendUint16);
+
+		return true;
+	}
+
+private:
+	// Gets every edge of every sector as a wall for the BSP tree
+	std::vector<BspBuilder::Segment> getWalls() const
+	{
+		std::vector<BspBuilder::Segment> walls;
+
+		for(size_t sectorIndex = 0; sectorIndex < this->sectors.size(); ++sectorIndex)
+		{
+			const std::vector<Point> & points = this->sectors[sectorIndex].points;
+
+			for(size_t index = 0; index < points.size(); ++index)
+			{
+				const Point & previous = points[(index + points.size() - 1) % points.size()];
+				const Point & point = points[index];
+				const Point & next = points[(index + 1) % points.size()];
+
+				const double length = hypot((next.x - point.x), (next.y - point.y));
+
+				uint8_t flags = 0;
+
+				if(previous.neighbour == noSector)
+					flags |= levelformat::segment::startsAfterWall;
+
+				if(next.neighbour != noSector)
+					flags |= levelformat::segment::endsBeforePortal;
+
+				walls.push_back({ point.x, point.y, next.x, next.y, 0, (length * point.textureScale), static_cast<SectorId>(sectorIndex), point.neighbour, flags, static_cast<uint8_t>(index) });
+			}
+		}
+
+		return walls;
+	}
+
+	bool fail(const char * format, size_t sector = 0, size_t point = 0)
+	{
+		char message[256];
+		snprintf(message, sizeof(message), format, sector, point);
+		this->error = message;
+		return false;
+	}
+
+	// Which side of the line through 'start' and 'end' a point is on.
+	// Positive is the left, which is the inside of an anticlockwise sector.
+	static double getSide(const Point & start, const Point & end, const Point & point)
+	{
+		return (((end.x - start.x) * (point.y - start.y)) - ((end.y - start.y) * (point.x - start.x)));
+	}
+
+	// Checks whether a sector has an edge from 'start' to 'end' leading to 'neighbour'
+	bool hasEdge(size_t sectorIndex, const Point & start, const Point & end, SectorId neighbour) const
+	{
+		const std::vector<Point> & points = this->sectors[sectorIndex].points;
+
+		for(size_t index = 0; index < points.size(); ++index)
+		{
+			const Point & point = points[index];
+			const Point & next = points[(index + 1) % points.size()];
+
+			if((point.x == start.x) && (point.y == start.y) && (next.x == end.x) && (next.y == end.y))
+				return (point.neighbour == neighbour);
+		}
+
+		return false;
+	}
+
+	bool validate(bool allowConcave)
+	{
+		const size_t sectorCount = this->sectors.size();
+
+		if(sectorCount == 0)
+			return this->fail("the level has no sectors");
+
+		if(sectorCount >= noSector)
+			return this->fail("the level has %zu sectors, more than the %zu allowed", sectorCount, (noSector - 1));
+
+		for(size_t sectorIndex = 0; sectorIndex < sectorCount; ++sectorIndex)
+		{
+			const SectorDescription & sector = this->sectors[sectorIndex];
+			const std::vector<Point> & points = sector.points;
+
+			if((sector.floorHeight < -maxHeight()) || (sector.ceilingHeight > maxHeight()))
+				return this->fail("sector %zu has a height outside of the map", sectorIndex);
+
+			if(sector.floorHeight >= sector.ceilingHeight)
+				return this->fail("sector %zu has a floor that isn't below its ceiling", sectorIndex);
+
+			if(points.size() < 3)
+				return this->fail("sector %zu has fewer than 3 points", sectorIndex);
+
+			if(points.size() > Sector::maxPoints)
+				return this->fail("sector %zu has more than %zu points", sectorIndex, Sector::maxPoints);
+
+			for(size_t index = 0; index < points.size(); ++index)
+			{
+				const Point & point = points[index];
+				const Point & next = points[(index + 1) % points.size()];
+
+				if((point.x < 0) || (point.y < 0) || (point.x > maxCoordinate()) || (point.y > maxCoordinate()))
+					return this->fail("sector %zu point %zu is outside of the map", sectorIndex, index);
+
+				if((point.x == next.x) && (point.y == next.y))
+					return this->fail("sector %zu point %zu is the same as the next point", sectorIndex, index);
+
+				if((point.textureScale <= 0) || (point.textureScale >= 128))
+					return this->fail("sector %zu point %zu has a texture scale outside of (0, 128)", sectorIndex, index);
+
+				// Convex and anticlockwise means every point is on or to the left of every edge
+				if(!allowConcave)
+					for(const Point & other : points)
+						if(getSide(point, next, other) < 0)
+							return this->fail("sector %zu is not convex and anticlockwise at point %zu", sectorIndex, index);
+
+				if(point.neighbour == noSector)
+					continue;
+
+				if((point.neighbour >= sectorCount) || (point.neighbour == sectorIndex))
+					return this->fail("sector %zu point %zu leads to a sector that doesn't exist", sectorIndex, index);
+
+				// Portals must be shared, so that the neighbour can see back
+				if(!this->hasEdge(point.neighbour, next, point, static_cast<SectorId>(sectorIndex)))
+					return this->fail("sector %zu point %zu leads to a sector without a matching edge", sectorIndex, index);
+			}
+		}
+
+		return true;
+	}
+
+	static void writeUint16(std::vector<uint8_t> & output, size_t offset, uint16_t value)
+	{
+		output[offset + 0] = static_cast<uint8_t>(value >> 0);
+		output[offset + 1] = static_cast<uint8_t>(value >> 8);
+	}
+
+	static void appendUint16(std::vector<uint8_t> & output, uint16_t value)
+	{
+		output.push_back(static_cast<uint8_t>(value >> 0));
+		output.push_back(static_cast<uint8_t>(value >> 8));
+	}
+
+	static void appendSQ15x16(std::vector<uint8_t> & output, double value)
+	{
+		const uint32_t internal = static_cast<uint32_t>(static_cast<int32_t>(lround(value * 65536)));
+
+		for(uint8_t shift = 0; shift < 32; shift += 8)
+			output.push_back(static_cast<uint8_t>(internal >> shift));
+	}
+
+	static void appendSQ7x8(std::vector<uint8_t> & output, double value)
+	{
+		const uint16_t internal = static_cast<uint16_t>(static_cast<int16_t>(lround(value * 256)));
+
+		output.push_back(static_cast<uint8_t>(internal >> 0));
+		output.push_back(static_cast<uint8_t>(internal >> 8));
+	}
+};
\ No newline at end of file
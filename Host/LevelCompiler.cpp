@@ -0,0 +1,224 @@
+// Compiles a level description into a header holding the level in the compiled level format.
+//
+// Usage: levelcompiler input output name
+//
+// The description is plain text. '#' starts a comment.
+// Each sector starts with a line holding 'sector', optionally followed by its floor and ceiling heights and its light:
+//
+//   sector [floorHeight ceilingHeight [light]]
+//
+// The floor defaults to 0 and the ceiling to 1, the height of a wall.
+// The light is the brightness of the sector's surfaces at a depth of 1, out of 16, and defaults to 12.
+// It is followed by a line for each of its points, anticlockwise:
+//
+//   x y across [textureScale]
+//
+// 'across' is what lies across the edge from this point to the next:
+// either the index of another sector, counting from 0 in the order they appear, or 'wall'.
+// The texture scale defaults to 1.
+
+#include <stdio.h>
+
+// For strtod, strtoul
+#include <stdlib.h>
+
+// For strcmp, strchr, strtok
+#include <string.h>
+
+// For std::vector
+#include <vector>
+
+#include "LevelBuilder.h"
+
+namespace
+{
+	bool parseNumber(const char * token, double & value)
+	{
+		char * end;
+		value = strtod(token, &end);
+		return ((end != token) && (*end == '\0'));
+	}
+
+	bool parseNeighbour(const char * token, SectorId & neighbour)
+	{
+		if(strcmp(token, "wall") == 0)
+		{
+			neighbour = noSector;
+			return true;
+		}
+
+		char * end;
+		const unsigned long value = strtoul(token, &end, 10);
+
+		if((end == token) || (*end != '\0') || (value >= noSector))
+			return false;
+
+		neighbour = static_cast<SectorId>(value);
+		return true;
+	}
+
+	bool parseLight(const char * token, uint8_t & light)
+	{
+		char * end;
+		const unsigned long value = strtoul(token, &end, 10);
+
+		if((end == token) || (*end != '\0') || (value > 0xFF))
+			return false;
+
+		light = static_cast<uint8_t>(value);
+		return true;
+	}
+
+	bool parse(FILE * file, const char * path, LevelBuilder & builder)
+	{
+		char line[256];
+		unsigned lineNumber = 0;
+
+		while(fgets(line, sizeof(line), file) != nullptr)
+		{
+			++lineNumber;
+
+			char * comment = strchr(line, '#');
+
+			if(comment != nullptr)
+				*comment = '\0';
+
+			const char * separators = " \t\r\n";
+
+			char * tokens[5];
+			size_t tokenCount = 0;
+
+			for(char * token = strtok(line, separators); token != nullptr; token = strtok(nullptr, separators))
+			{
+				if(tokenCount == 5)
+				{
+					fprintf(stderr, "%s:%u: too many values\n", path, lineNumber);
+					return false;
+				}
+
+				tokens[tokenCount] = token;
+				++tokenCount;
+			}
+
+			if(tokenCount == 0)
+				continue;
+
+			if(strcmp(tokens[0], "sector") == 0)
+			{
+				double floorHeight = 0;
+				double ceilingHeight = 1;
+				uint8_t light = LevelBuilder::defaultLight();
+
+				if((tokenCount == 2) || (tokenCount > 4) ||
+					((tokenCount >= 3) && (!parseNumber(tokens[1], floorHeight) || !parseNumber(tokens[2], ceilingHeight))) ||
+					((tokenCount == 4) && !parseLight(tokens[3], light)))
+				{
+					fprintf(stderr, "%s:%u: expected 'sector [floorHeight ceilingHeight [light]]'\n", path, lineNumber);
+					return false;
+				}
+
+				builder.addSector(floorHeight, ceilingHeight, light);
+				continue;
+			}
+
+			if(builder.getSectorCount() == 0)
+			{
+				fprintf(stderr, "%s:%u: expected 'sector'\n", path, lineNumber);
+				return false;
+			}
+
+			double x;
+			double y;
+			SectorId neighbour;
+			double textureScale = 1;
+
+			if((tokenCount < 3) || (tokenCount > 4) ||
+				!parseNumber(tokens[0], x) ||
+				!parseNumber(tokens[1], y) ||
+				!parseNeighbour(tokens[2], neighbour) ||
+				((tokenCount == 4) && !parseNumber(tokens[3], textureScale)))
+			{
+				fprintf(stderr, "%s:%u: expected 'x y across [textureScale]'\n", path, lineNumber);
+				return false;
+			}
+
+			builder.addPoint(x, y, neighbour, textureScale);
+		}
+
+		return true;
+	}
+
+	bool writeHeader(FILE * file, const char * inputPath, const char * name, const std::vector<uint8_t> & data, size_t pointCount)
+	{
+		fprintf(file, "#pragma once\n\n");
+		fprintf(file, "// Generated by Host/LevelCompiler.cpp from %s.\n", inputPath);
+		fprintf(file, "// Edit the description and recompile it instead of editing this file.\n\n");
+		fprintf(file, "#include <stdint.h>\n");
+		fprintf(file, "#include <avr/pgmspace.h>\n\n");
+		fprintf(file, "const uint8_t %s[] PROGMEM\n{", name);
+
+		for(size_t index = 0; index < data.size(); ++index)
+			fprintf(file, "%s0x%02X,", (((index % 16) == 0) ? "\n\t" : " "), data[index]);
+
+		fprintf(file, "\n};\n\n");
+
+		// Enough for a VertexCache to hold every point of the level
+		fprintf(file, "constexpr uint16_t %sPointCount = %zu;\n", name, pointCount);
+
+		return (ferror(file) == 0);
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	if(argc != 4)
+	{
+		fprintf(stderr, "Usage: %s input output name\n", argv[0]);
+		return 1;
+	}
+
+	const char * inputPath = argv[1];
+	const char * outputPath = argv[2];
+	const char * name = argv[3];
+
+	FILE * input = fopen(inputPath, "r");
+
+	if(input == nullptr)
+	{
+		fprintf(stderr, "%s: can't open\n", inputPath);
+		return 1;
+	}
+
+	LevelBuilder builder;
+	const bool parsed = parse(input, inputPath, builder);
+	fclose(input);
+
+	if(!parsed)
+		return 1;
+
+	std::vector<uint8_t> data;
+
+	if(!builder.build(data))
+	{
+		fprintf(stderr, "%s: %s\n", inputPath, builder.getError().c_str());
+		return 1;
+	}
+
+	FILE * output = fopen(outputPath, "w");
+
+	if(output == nullptr)
+	{
+		fprintf(stderr, "%s: can't create\n", outputPath);
+		return 1;
+	}
+
+	const bool written = writeHeader(output, inputPath, name, data, builder.getPointCount());
+
+	if((fclose(output) != 0) || !written)
+	{
+		fprintf(stderr, "%s: can't write\n", outputPath);
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
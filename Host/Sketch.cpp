@@ -0,0 +1,26 @@
+// Runs the sketch headlessly for a number of frames.
+//
+// Usage: sketch [frames]
+
+// For atoi
+#include <stdlib.h>
+
+// For printf
+#include <stdio.h>
+
+#include "../Ardoom/Ardoom.ino"
+
+int main(int argc, char ** argv)
+{
+	const long frameCount = (argc > 1) ? atol(argv[1]) : 60;
+
+	setup();
+
+	for(long frame = 0; frame < frameCount; ++frame)
+		loop();
+
+	// Unchanged frames aren't sent to the display
+	printf("%lu of %ld frames displayed\n", static_cast<unsigned long>(Arduboy2::counters.displayCalls), frameCount);
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+// Host stand-in for avr-libc's program memory support.
+// There is only one address space on the host, so program memory is ordinary memory.
+
+// For uint8_t, uint16_t, uint32_t
+#include <stdint.h>
+
+// For memcpy
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(string) (string)
+
+// Words and double words may be unaligned, as they can be on the AVR
+template<typename Type>
+inline Type pgm_read_unaligned(const void * address)
+{
+	Type value;
+	memcpy(&value, address, sizeof(value));
+	return value;
+}
+
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t *>(address))
+#define pgm_read_word(address) pgm_read_unaligned<uint16_t>(address)
+#define pgm_read_dword(address) pgm_read_unaligned<uint32_t>(address)
+#define pgm_read_ptr(address) (*reinterpret_cast<const void * const *>(address))
+
+#define memcpy_P(destination, source, size) memcpy((destination), (source), (size))